@@ -0,0 +1,572 @@
+/**
+ * @file atomic_maybe.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains an atomic single slot maybe used to hand values between threads
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_ATOMIC_MAYBE_HPP
+#define LIBREGLISSE_ATOMIC_MAYBE_HPP
+
+#include <libreglisse/maybe.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace reglisse::inline v0
+{
+   /**
+    * @brief Trait giving a value of 'T' that 'atomic_maybe<T>' stores to represent the empty
+    * slot, so the slot holds the value alone instead of the value & a discriminant byte.
+    *
+    * Specialize it with a 'static constexpr T value' member for payloads of 8 bytes, whose slot
+    * would otherwise take 16 bytes & not be lock-free with GCC. Payloads only have a niche when
+    * they opt in, since the niche value itself may then no longer be stored: storing
+    * 'some(value)' fails an assertion.
+    */
+   template <typename T>
+   struct atomic_maybe_niche
+   {
+   };
+
+   /**
+    * @brief A niche for 'double', a signaling NaN that arithmetic never produces. Opt in with
+    * 'template <> struct reglisse::atomic_maybe_niche<double> : reglisse::signaling_nan_niche {};'
+    */
+   struct signaling_nan_niche
+   {
+      static constexpr double value = std::bit_cast<double>(0x7FF0'0000'0000'0001ULL); // NOLINT
+   };
+
+   namespace detail
+   {
+      // clang-format off
+
+      /**
+       * @brief Payloads with a niche value of a power of two size, stored without a
+       * discriminant.
+       */
+      template <typename T>
+      concept niche_payload = requires
+      {
+         { atomic_maybe_niche<T>::value } -> std::convertible_to<T>;
+      } and std::has_single_bit(sizeof(T)) and sizeof(T) <= 16;
+
+      // clang-format on
+
+      /**
+       * @brief Payloads whose object representation holds no padding, so that equal values
+       * always have the same bytes. Floating point types are accepted since they have no
+       * padding bits on the supported platforms, 'long double' aside.
+       */
+      template <typename T>
+      concept padding_free = std::has_unique_object_representations_v<T> or
+         std::same_as<T, float> or std::same_as<T, double>;
+
+      /**
+       * @brief Derive the failure order of a compare exchange from its single memory order, as
+       * 'std::atomic' does.
+       */
+      constexpr auto cas_failure_order(std::memory_order order) noexcept -> std::memory_order
+      {
+         if (order == std::memory_order_acq_rel)
+         {
+            return std::memory_order_acquire;
+         }
+
+         if (order == std::memory_order_release)
+         {
+            return std::memory_order_relaxed;
+         }
+
+         return order;
+      }
+
+      /**
+       * @brief Compute the size of the atomic representation of a maybe, rounded up to a power
+       * of two to allow lock-free access for small types.
+       */
+      template <typename T>
+      constexpr auto atomic_maybe_storage_size() -> std::size_t
+      {
+         if constexpr (niche_payload<T>)
+         {
+            return sizeof(T);
+         }
+         else
+         {
+            constexpr std::size_t size = sizeof(T) + 1;
+
+            return size <= 16 ? std::bit_ceil(size) : size;
+         }
+      }
+
+      /**
+       * @brief The object representation of a maybe stored in an atomic_maybe.
+       *
+       * The value occupies the first bytes & the discriminant the last one, unless the payload
+       * has a niche, in which case the empty slot holds the bytes of the niche. All the
+       * remaining bytes are always zero so that two equal monads always have the same
+       * representation.
+       */
+      template <typename T>
+      struct alignas(atomic_maybe_storage_size<T>() <= 16 ? atomic_maybe_storage_size<T>()
+                                                          : alignof(T)) atomic_maybe_storage
+      {
+         std::array<std::byte, atomic_maybe_storage_size<T>()> bytes{};
+      };
+   } // namespace detail
+
+   /**
+    * @brief An atomic slot that may or may not contain a value.
+    *
+    * It is meant to be used as a single slot mailbox between threads. A producer publishes a
+    * value with 'store(some(value))' and a consumer gets it back with 'take()', which also empties
+    * the slot. Values are read back as a maybe so they may be piped through the operations right
+    * away.
+    *
+    * The slot is lock-free whenever the platform supports atomics of the size of the value plus
+    * one byte, rounded up to a power of two, so only payloads of 7 bytes or less are lock-free on
+    * every mainstream platform. Payloads of 8 bytes take a 16 byte slot, which GCC implements
+    * with a lock in libatomic, unless they have an 'atomic_maybe_niche'. Contents are compared
+    * through their bytes, so payloads may not hold padding.
+    */
+   template <typename T>
+      requires std::is_trivially_copyable_v<T> and detail::padding_free<T>
+   class atomic_maybe
+   {
+      using storage_type = detail::atomic_maybe_storage<T>;
+
+   public:
+      using value_type = T;
+
+      static constexpr bool is_always_lock_free = std::atomic<storage_type>::is_always_lock_free;
+
+   public:
+      /**
+       * @brief Construct an empty slot.
+       */
+      constexpr atomic_maybe() noexcept = default;
+      /**
+       * @brief Construct a slot holding the content of a maybe.
+       *
+       * @param [in] desired The initial content of the slot.
+       */
+      constexpr atomic_maybe(const maybe<value_type>& desired) noexcept : m_storage(encode(desired))
+      {}
+      atomic_maybe(const atomic_maybe&) = delete;
+      atomic_maybe(atomic_maybe&&) = delete;
+      ~atomic_maybe() = default;
+
+      auto operator=(const atomic_maybe&) -> atomic_maybe& = delete;
+      auto operator=(atomic_maybe&&) -> atomic_maybe& = delete;
+
+      /**
+       * @brief Replace the content of the slot.
+       *
+       * @param [in] desired The new content of the slot.
+       * @param [in] order The memory order of the operation.
+       */
+      void store(const maybe<value_type>& desired,
+                 std::memory_order order = std::memory_order_seq_cst) noexcept
+      {
+         m_storage.store(encode(desired), order);
+      }
+      /**
+       * @brief Read the content of the slot without modifying it.
+       *
+       * @param [in] order The memory order of the operation.
+       *
+       * @return The current content of the slot.
+       */
+      [[nodiscard]] auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+         -> maybe<value_type>
+      {
+         return decode(m_storage.load(order));
+      }
+      /**
+       * @brief Replace the content of the slot & get the previous one.
+       *
+       * @param [in] desired The new content of the slot.
+       * @param [in] order The memory order of the operation.
+       *
+       * @return The previous content of the slot.
+       */
+      auto exchange(const maybe<value_type>& desired,
+                    std::memory_order order = std::memory_order_seq_cst) noexcept
+         -> maybe<value_type>
+      {
+         return decode(m_storage.exchange(encode(desired), order));
+      }
+      /**
+       * @brief Take the content of the slot, leaving it empty.
+       *
+       * @param [in] order The memory order of the operation.
+       *
+       * @return The previous content of the slot.
+       */
+      auto take(std::memory_order order = std::memory_order_seq_cst) noexcept -> maybe<value_type>
+      {
+         return exchange(none, order);
+      }
+
+      /**
+       * @brief Replace the content of the slot if it is equal to 'expected'.
+       *
+       * Contents are compared through their object representation. On failure, 'expected' is
+       * updated with the current content of the slot.
+       *
+       * @param [in, out] expected The expected content of the slot.
+       * @param [in] desired The new content of the slot.
+       * @param [in] success The memory order used if the comparison succeeds.
+       * @param [in] failure The memory order used if the comparison fails.
+       *
+       * @return true if the content was replaced.
+       */
+      auto compare_exchange_strong(maybe<value_type>& expected, const maybe<value_type>& desired,
+                                   std::memory_order success, std::memory_order failure) noexcept
+         -> bool
+      {
+         storage_type current = encode(expected);
+
+         if (m_storage.compare_exchange_strong(current, encode(desired), success, failure))
+         {
+            return true;
+         }
+
+         expected = decode(current);
+
+         return false;
+      }
+      /**
+       * @brief Replace the content of the slot if it is equal to 'expected'.
+       *
+       * Contents are compared through their object representation. On failure, 'expected' is
+       * updated with the current content of the slot.
+       *
+       * @param [in, out] expected The expected content of the slot.
+       * @param [in] desired The new content of the slot.
+       * @param [in] order The memory order of the operation.
+       *
+       * @return true if the content was replaced.
+       */
+      auto compare_exchange_strong(maybe<value_type>& expected, const maybe<value_type>& desired,
+                                   std::memory_order order = std::memory_order_seq_cst) noexcept
+         -> bool
+      {
+         return compare_exchange_strong(expected, desired, order, detail::cas_failure_order(order));
+      }
+      /**
+       * @brief Replace the content of the slot if it is equal to 'expected'. May fail spuriously.
+       *
+       * Contents are compared through their object representation. On failure, 'expected' is
+       * updated with the current content of the slot.
+       *
+       * @param [in, out] expected The expected content of the slot.
+       * @param [in] desired The new content of the slot.
+       * @param [in] success The memory order used if the comparison succeeds.
+       * @param [in] failure The memory order used if the comparison fails.
+       *
+       * @return true if the content was replaced.
+       */
+      auto compare_exchange_weak(maybe<value_type>& expected, const maybe<value_type>& desired,
+                                 std::memory_order success, std::memory_order failure) noexcept
+         -> bool
+      {
+         storage_type current = encode(expected);
+
+         if (m_storage.compare_exchange_weak(current, encode(desired), success, failure))
+         {
+            return true;
+         }
+
+         expected = decode(current);
+
+         return false;
+      }
+      /**
+       * @brief Replace the content of the slot if it is equal to 'expected'. May fail spuriously.
+       *
+       * Contents are compared through their object representation. On failure, 'expected' is
+       * updated with the current content of the slot.
+       *
+       * @param [in, out] expected The expected content of the slot.
+       * @param [in] desired The new content of the slot.
+       * @param [in] order The memory order of the operation.
+       *
+       * @return true if the content was replaced.
+       */
+      auto compare_exchange_weak(maybe<value_type>& expected, const maybe<value_type>& desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept
+         -> bool
+      {
+         return compare_exchange_weak(expected, desired, order, detail::cas_failure_order(order));
+      }
+
+      /**
+       * @brief Check if the operations on the slot are lock-free.
+       */
+      [[nodiscard]] auto is_lock_free() const noexcept -> bool { return m_storage.is_lock_free(); }
+
+   private:
+      using value_bytes = std::array<std::byte, sizeof(value_type)>;
+
+      static constexpr auto encode(const maybe<value_type>& m) noexcept -> storage_type
+      {
+         storage_type res{};
+
+         if constexpr (detail::niche_payload<value_type>)
+         {
+            constexpr auto niche =
+               std::bit_cast<value_bytes>(value_type(atomic_maybe_niche<value_type>::value));
+
+            const auto bytes = m.is_some() ? std::bit_cast<value_bytes>(m.borrow()) : niche;
+
+            assert((m.is_none() or bytes != niche) && "the niche value cannot be stored"); // NOLINT
+
+            std::copy(std::begin(bytes), std::end(bytes), std::begin(res.bytes));
+         }
+         else if (m.is_some())
+         {
+            const auto bytes = std::bit_cast<value_bytes>(m.borrow());
+
+            std::copy(std::begin(bytes), std::end(bytes), std::begin(res.bytes));
+            res.bytes.back() = std::byte{1};
+         }
+
+         return res;
+      }
+      static constexpr auto decode(const storage_type& storage) noexcept -> maybe<value_type>
+      {
+         if constexpr (detail::niche_payload<value_type>)
+         {
+            if (storage.bytes ==
+                std::bit_cast<value_bytes>(value_type(atomic_maybe_niche<value_type>::value)))
+            {
+               return none;
+            }
+         }
+         else if (storage.bytes.back() == std::byte{0})
+         {
+            return none;
+         }
+
+         value_bytes bytes{};
+         std::copy_n(std::begin(storage.bytes), sizeof(value_type), std::begin(bytes));
+
+         return some(std::bit_cast<value_type>(bytes));
+      }
+
+   private:
+      std::atomic<storage_type> m_storage{encode(none)};
+   };
+
+   /**
+    * @brief An atomic slot that may or may not contain a pointer.
+    *
+    * The specialization stores a single pointer and is lock-free on every mainstream platform.
+    * A null pointer is used to represent the empty slot, so storing 'some(nullptr)' empties the
+    * slot.
+    */
+   template <typename T>
+   class atomic_maybe<T*>
+   {
+   public:
+      using value_type = T*;
+
+      static constexpr bool is_always_lock_free = std::atomic<value_type>::is_always_lock_free;
+
+   public:
+      /**
+       * @brief Construct an empty slot.
+       */
+      constexpr atomic_maybe() noexcept = default;
+      /**
+       * @brief Construct a slot holding the content of a maybe.
+       *
+       * @param [in] desired The initial content of the slot.
+       */
+      constexpr atomic_maybe(const maybe<value_type>& desired) noexcept :
+         m_pointer(encode(desired))
+      {}
+      atomic_maybe(const atomic_maybe&) = delete;
+      atomic_maybe(atomic_maybe&&) = delete;
+      ~atomic_maybe() = default;
+
+      auto operator=(const atomic_maybe&) -> atomic_maybe& = delete;
+      auto operator=(atomic_maybe&&) -> atomic_maybe& = delete;
+
+      /**
+       * @brief Replace the content of the slot.
+       *
+       * @param [in] desired The new content of the slot.
+       * @param [in] order The memory order of the operation.
+       */
+      void store(const maybe<value_type>& desired,
+                 std::memory_order order = std::memory_order_seq_cst) noexcept
+      {
+         m_pointer.store(encode(desired), order);
+      }
+      /**
+       * @brief Read the content of the slot without modifying it.
+       *
+       * @param [in] order The memory order of the operation.
+       *
+       * @return The current content of the slot.
+       */
+      [[nodiscard]] auto load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+         -> maybe<value_type>
+      {
+         return decode(m_pointer.load(order));
+      }
+      /**
+       * @brief Replace the content of the slot & get the previous one.
+       *
+       * @param [in] desired The new content of the slot.
+       * @param [in] order The memory order of the operation.
+       *
+       * @return The previous content of the slot.
+       */
+      auto exchange(const maybe<value_type>& desired,
+                    std::memory_order order = std::memory_order_seq_cst) noexcept
+         -> maybe<value_type>
+      {
+         return decode(m_pointer.exchange(encode(desired), order));
+      }
+      /**
+       * @brief Take the content of the slot, leaving it empty.
+       *
+       * @param [in] order The memory order of the operation.
+       *
+       * @return The previous content of the slot.
+       */
+      auto take(std::memory_order order = std::memory_order_seq_cst) noexcept -> maybe<value_type>
+      {
+         return exchange(none, order);
+      }
+
+      /**
+       * @brief Replace the content of the slot if it holds the pointer of 'expected'.
+       *
+       * On failure, 'expected' is updated with the current content of the slot.
+       *
+       * @param [in, out] expected The expected content of the slot.
+       * @param [in] desired The new content of the slot.
+       * @param [in] success The memory order used if the comparison succeeds.
+       * @param [in] failure The memory order used if the comparison fails.
+       *
+       * @return true if the content was replaced.
+       */
+      auto compare_exchange_strong(maybe<value_type>& expected, const maybe<value_type>& desired,
+                                   std::memory_order success, std::memory_order failure) noexcept
+         -> bool
+      {
+         value_type current = encode(expected);
+
+         if (m_pointer.compare_exchange_strong(current, encode(desired), success, failure))
+         {
+            return true;
+         }
+
+         expected = decode(current);
+
+         return false;
+      }
+      /**
+       * @brief Replace the content of the slot if it holds the pointer of 'expected'.
+       *
+       * On failure, 'expected' is updated with the current content of the slot.
+       *
+       * @param [in, out] expected The expected content of the slot.
+       * @param [in] desired The new content of the slot.
+       * @param [in] order The memory order of the operation.
+       *
+       * @return true if the content was replaced.
+       */
+      auto compare_exchange_strong(maybe<value_type>& expected, const maybe<value_type>& desired,
+                                   std::memory_order order = std::memory_order_seq_cst) noexcept
+         -> bool
+      {
+         return compare_exchange_strong(expected, desired, order, detail::cas_failure_order(order));
+      }
+      /**
+       * @brief Replace the content of the slot if it holds the pointer of 'expected'. May fail
+       * spuriously.
+       *
+       * On failure, 'expected' is updated with the current content of the slot.
+       *
+       * @param [in, out] expected The expected content of the slot.
+       * @param [in] desired The new content of the slot.
+       * @param [in] success The memory order used if the comparison succeeds.
+       * @param [in] failure The memory order used if the comparison fails.
+       *
+       * @return true if the content was replaced.
+       */
+      auto compare_exchange_weak(maybe<value_type>& expected, const maybe<value_type>& desired,
+                                 std::memory_order success, std::memory_order failure) noexcept
+         -> bool
+      {
+         value_type current = encode(expected);
+
+         if (m_pointer.compare_exchange_weak(current, encode(desired), success, failure))
+         {
+            return true;
+         }
+
+         expected = decode(current);
+
+         return false;
+      }
+      /**
+       * @brief Replace the content of the slot if it holds the pointer of 'expected'. May fail
+       * spuriously.
+       *
+       * On failure, 'expected' is updated with the current content of the slot.
+       *
+       * @param [in, out] expected The expected content of the slot.
+       * @param [in] desired The new content of the slot.
+       * @param [in] order The memory order of the operation.
+       *
+       * @return true if the content was replaced.
+       */
+      auto compare_exchange_weak(maybe<value_type>& expected, const maybe<value_type>& desired,
+                                 std::memory_order order = std::memory_order_seq_cst) noexcept
+         -> bool
+      {
+         return compare_exchange_weak(expected, desired, order, detail::cas_failure_order(order));
+      }
+
+      /**
+       * @brief Check if the operations on the slot are lock-free.
+       */
+      [[nodiscard]] auto is_lock_free() const noexcept -> bool { return m_pointer.is_lock_free(); }
+
+   private:
+      static constexpr auto encode(const maybe<value_type>& m) noexcept -> value_type
+      {
+         return m.is_some() ? m.borrow() : nullptr;
+      }
+      static constexpr auto decode(value_type pointer) noexcept -> maybe<value_type>
+      {
+         if (pointer == nullptr)
+         {
+            return none;
+         }
+
+         return some(pointer);
+      }
+
+   private:
+      std::atomic<value_type> m_pointer{nullptr};
+   };
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_ATOMIC_MAYBE_HPP
@@ -0,0 +1,349 @@
+/**
+ * @file cache.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains a bounded concurrent cache & the adaptor memoizing functions with it
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_CACHE_HPP
+#define LIBREGLISSE_CACHE_HPP
+
+#include <libreglisse/detail/ring_buffer.hpp>
+#include <libreglisse/maybe.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace reglisse::inline v0
+{
+   /**
+    * @brief The counters of a cache, for monitoring.
+    */
+   struct cache_stats
+   {
+      std::uint64_t hits = 0;
+      std::uint64_t misses = 0;
+      std::uint64_t evictions = 0;
+   };
+
+   /**
+    * @brief A bounded, thread safe cache using the CLOCK eviction policy.
+    *
+    * The keys are spread over independent shards, each guarded by its own mutex, to keep
+    * contention low. Within a shard, the entries live in a fixed ring of slots. A lookup only sets
+    * the reference bit of the entry it finds, and an insertion into a full shard sweeps the ring,
+    * clearing reference bits until it finds an entry that was not used since the last sweep. This
+    * approximates LRU without reordering a list on every hit.
+    *
+    * Values are copied out of the cache, so they should be cheap to copy. Monads such as 'result'
+    * may be stored as they are, which caches errors as well as values.
+    */
+   template <std::copy_constructible Key, std::copy_constructible Value,
+             typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+   class clock_cache
+   {
+      struct entry
+      {
+         Key key;
+         Value value;
+      };
+
+      struct slot
+      {
+         maybe<entry> content = none;
+         bool referenced = false;
+      };
+
+      struct alignas(detail::cache_line_size) shard
+      {
+         std::mutex mutex;
+         std::vector<slot> slots;
+         std::unordered_map<Key, std::size_t, Hash, KeyEqual> index;
+         std::size_t hand = 0;
+
+         std::atomic<std::uint64_t> hits = 0;
+         std::atomic<std::uint64_t> misses = 0;
+         std::atomic<std::uint64_t> evictions = 0;
+      };
+
+   public:
+      using key_type = Key;
+      using mapped_type = Value;
+
+   public:
+      /**
+       * @brief Construct a cache holding at most 'capacity' entries.
+       *
+       * @param [in] capacity The maximum number of entries, rounded up to a multiple of the
+       * number of shards.
+       * @param [in] shard_count The number of independent shards, by default the number of
+       * hardware threads rounded to a power of two.
+       */
+      explicit clock_cache(std::size_t capacity, std::size_t shard_count = default_shard_count()) :
+         m_shard_count(std::bit_ceil(
+            std::clamp<std::size_t>(shard_count, 1, std::max<std::size_t>(capacity, 1)))),
+         m_shards(std::make_unique<shard[]>(m_shard_count)) // NOLINT
+      {
+         const std::size_t slots_per_shard = (capacity + m_shard_count - 1) / m_shard_count;
+
+         for (std::size_t i = 0; i < m_shard_count; ++i)
+         {
+            m_shards[i].slots.resize(std::max<std::size_t>(slots_per_shard, 1));
+            m_shards[i].index.reserve(slots_per_shard);
+         }
+      }
+      clock_cache(const clock_cache&) = delete;
+      clock_cache(clock_cache&&) = delete;
+      ~clock_cache() = default;
+
+      auto operator=(const clock_cache&) -> clock_cache& = delete;
+      auto operator=(clock_cache&&) -> clock_cache& = delete;
+
+      /**
+       * @brief Look up the value cached for 'key', counting a hit or a miss.
+       *
+       * @returns A copy of the cached value, or none.
+       */
+      auto find(const key_type& key) -> maybe<mapped_type>
+      {
+         shard& s = shard_of(key);
+         const std::lock_guard lock(s.mutex);
+
+         if (auto it = s.index.find(key); it != std::end(s.index))
+         {
+            slot& found = s.slots[it->second];
+            found.referenced = true;
+            s.hits.fetch_add(1, std::memory_order_relaxed);
+
+            return some(found.content.borrow().value);
+         }
+
+         s.misses.fetch_add(1, std::memory_order_relaxed);
+
+         return none;
+      }
+
+      /**
+       * @brief Cache 'value' for 'key', replacing the previous value if there is one. If the shard
+       * of the key is full, the first entry found unused since the last sweep is evicted.
+       */
+      void insert(const key_type& key, mapped_type value)
+      {
+         shard& s = shard_of(key);
+         const std::lock_guard lock(s.mutex);
+
+         if (auto it = s.index.find(key); it != std::end(s.index))
+         {
+            slot& found = s.slots[it->second];
+            found.content.borrow().value = std::move(value);
+            found.referenced = true;
+
+            return;
+         }
+
+         const std::size_t position = claim_slot(s);
+
+         s.slots[position].content = some(entry{key, std::move(value)});
+         s.slots[position].referenced = false;
+         s.index.emplace(key, position);
+      }
+
+      /**
+       * @brief Get the value cached for 'key', or compute it with 'func' & cache it.
+       *
+       * 'func' is called without holding any lock, so threads missing on the same key at the
+       * same time may each call it. This is harmless for the pure functions a cache is meant for.
+       */
+      template <std::invocable<const key_type&> Func>
+         requires std::convertible_to<std::invoke_result_t<Func&, const key_type&>, mapped_type>
+      auto get_or_insert(const key_type& key, Func& func) -> mapped_type
+      {
+         if (maybe<mapped_type> hit = find(key))
+         {
+            return std::move(hit).take();
+         }
+
+         mapped_type value = std::invoke(func, key);
+         insert(key, value);
+
+         return value;
+      }
+
+      /**
+       * @brief Remove every entry. The counters are kept.
+       */
+      void clear()
+      {
+         for (std::size_t i = 0; i < m_shard_count; ++i)
+         {
+            shard& s = m_shards[i];
+            const std::lock_guard lock(s.mutex);
+
+            for (slot& current : s.slots)
+            {
+               current.content.reset();
+               current.referenced = false;
+            }
+
+            s.index.clear();
+            s.hand = 0;
+         }
+      }
+
+      /**
+       * @brief Sum the counters of every shard. The counters are read without locking, so the
+       * snapshot may be slightly out of date under concurrent use.
+       */
+      [[nodiscard]] auto stats() const noexcept -> cache_stats
+      {
+         cache_stats res;
+
+         for (std::size_t i = 0; i < m_shard_count; ++i)
+         {
+            const shard& s = m_shards[i];
+
+            res.hits += s.hits.load(std::memory_order_relaxed);
+            res.misses += s.misses.load(std::memory_order_relaxed);
+            res.evictions += s.evictions.load(std::memory_order_relaxed);
+         }
+
+         return res;
+      }
+
+      /**
+       * @brief Get the number of entries currently cached.
+       */
+      [[nodiscard]] auto size() const -> std::size_t
+      {
+         std::size_t res = 0;
+
+         for (std::size_t i = 0; i < m_shard_count; ++i)
+         {
+            const std::lock_guard lock(m_shards[i].mutex);
+            res += m_shards[i].index.size();
+         }
+
+         return res;
+      }
+
+      /**
+       * @brief Get the maximum number of entries of the cache.
+       */
+      [[nodiscard]] auto capacity() const noexcept -> std::size_t
+      {
+         return m_shard_count * m_shards[0].slots.size();
+      }
+
+   private:
+      static auto default_shard_count() -> std::size_t
+      {
+         return std::bit_ceil(std::max<std::size_t>(std::thread::hardware_concurrency(), 1));
+      }
+
+      auto shard_of(const key_type& key) const -> shard&
+      {
+         // Mix the hash since standard hashes of integers are often the identity.
+         auto hash = static_cast<std::uint64_t>(m_hasher(key));
+         hash ^= hash >> 33U;
+         hash *= 0xff51afd7ed558ccdULL; // NOLINT
+         hash ^= hash >> 33U;
+
+         return m_shards[hash & (m_shard_count - 1)];
+      }
+
+      /**
+       * @brief Find a free slot in the shard, evicting an entry if needed. The mutex of the shard
+       * must be held.
+       */
+      static auto claim_slot(shard& s) -> std::size_t
+      {
+         while (true)
+         {
+            const std::size_t position = s.hand;
+            slot& current = s.slots[position];
+
+            s.hand = (s.hand + 1) % s.slots.size();
+
+            if (current.content.is_none())
+            {
+               return position;
+            }
+
+            if (current.referenced)
+            {
+               current.referenced = false;
+            }
+            else
+            {
+               s.index.erase(current.content.borrow().key);
+               current.content.reset();
+               s.evictions.fetch_add(1, std::memory_order_relaxed);
+
+               return position;
+            }
+         }
+      }
+
+   private:
+      std::size_t m_shard_count;
+      std::unique_ptr<shard[]> m_shards; // NOLINT
+
+      [[no_unique_address]] Hash m_hasher{};
+   };
+
+   namespace detail
+   {
+      template <typename Func, typename Cache>
+      class cached_fn
+      {
+      public:
+         constexpr cached_fn(Func func, Cache& cache) :
+            m_func(std::move(func)), m_cache(std::addressof(cache))
+         {}
+
+         template <typename Key>
+            requires std::convertible_to<Key, typename Cache::key_type>
+         auto operator()(Key&& key) const -> typename Cache::mapped_type
+         {
+            return m_cache->get_or_insert(static_cast<const typename Cache::key_type&>(key),
+                                          m_func);
+         }
+
+      private:
+         mutable Func m_func;
+         Cache* m_cache;
+      };
+   } // namespace detail
+
+   /**
+    * @brief Memoize a pure function of a single argument in 'cache'.
+    *
+    * The returned function may be passed to any operation, as in
+    * 'res | and_then(cached(lookup, cache))'. It refers to 'cache', which must outlive it.
+    *
+    * @param [in] func The function to memoize, it must be safe to call concurrently if the
+    * cache is shared between threads.
+    * @param [in] cache The cache holding the results of 'func'.
+    */
+   template <typename Func, typename Cache>
+      requires std::invocable<std::decay_t<Func>&, const typename Cache::key_type&>
+   constexpr auto cached(Func&& func, Cache& cache)
+   {
+      return detail::cached_fn<std::decay_t<Func>, Cache>(std::forward<Func>(func), cache);
+   }
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_CACHE_HPP
@@ -0,0 +1,502 @@
+/**
+ * @file column_file.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Contains the file format of persisted columns of monads & their memory mapped reader
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_COLUMN_FILE_HPP
+#define LIBREGLISSE_COLUMN_FILE_HPP
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+#include <libreglisse/serialization.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <ostream>
+#include <span>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+#   if not defined(NOMINMAX)
+#      define NOMINMAX
+#      define LIBREGLISSE_DEFINED_NOMINMAX
+#   endif
+#   if not defined(WIN32_LEAN_AND_MEAN)
+#      define WIN32_LEAN_AND_MEAN
+#      define LIBREGLISSE_DEFINED_WIN32_LEAN_AND_MEAN
+#   endif
+#   include <windows.h>
+#   if defined(LIBREGLISSE_DEFINED_NOMINMAX)
+#      undef NOMINMAX
+#      undef LIBREGLISSE_DEFINED_NOMINMAX
+#   endif
+#   if defined(LIBREGLISSE_DEFINED_WIN32_LEAN_AND_MEAN)
+#      undef WIN32_LEAN_AND_MEAN
+#      undef LIBREGLISSE_DEFINED_WIN32_LEAN_AND_MEAN
+#   endif
+#else
+#   include <fcntl.h>
+#   include <sys/mman.h>
+#   include <sys/stat.h>
+#   include <unistd.h>
+#endif
+
+namespace reglisse::inline v0
+{
+   /**
+    * @brief The reasons a column file may fail to open.
+    */
+   enum struct column_error : std::uint8_t
+   {
+      open_failed,         ///< The file could not be opened or its size could not be read
+      map_failed,          ///< The file could not be mapped in memory
+      invalid_magic,       ///< The file does not start with the magic bytes of a column
+      unsupported_version, ///< The file was written by another version of the format
+      type_mismatch,       ///< The file holds another monad or payloads of another size
+      truncated,           ///< The file ends before the column it describes
+      corrupted            ///< The counts of the column disagree with its bitmap
+   };
+
+   /**
+    * @brief How a mapped file is expected to be read, forwarded to the operating system.
+    */
+   enum struct access_hint : std::uint8_t
+   {
+      normal,
+      sequential,
+      random
+   };
+
+   inline constexpr std::array<char, 8> column_magic = {'R', 'G', 'L', 'S', 'C', 'O', 'L', '\0'};
+   inline constexpr std::uint32_t column_version = 1;
+
+   /**
+    * @brief The size of the header of a column file. The array starts right after it, so its
+    * sections keep their alignment in a mapping, which starts on a page.
+    */
+   inline constexpr std::size_t column_header_size = 64;
+
+   /**
+    * @brief A read-only mapping of a whole file in memory, unmapped on destruction. Pages are
+    * only read from the file when touched.
+    */
+   class mapped_file
+   {
+   public:
+      /**
+       * @brief Map the file at 'path'.
+       */
+      static auto open(const std::filesystem::path& path, access_hint hint = access_hint::normal)
+      {
+         using res_t = result<mapped_file, column_error>;
+
+#if defined(_WIN32)
+         DWORD flags = FILE_ATTRIBUTE_NORMAL;
+         if (hint == access_hint::sequential)
+         {
+            flags = FILE_FLAG_SEQUENTIAL_SCAN;
+         }
+         else if (hint == access_hint::random)
+         {
+            flags = FILE_FLAG_RANDOM_ACCESS;
+         }
+
+         HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                     OPEN_EXISTING, flags, nullptr);
+         if (file == INVALID_HANDLE_VALUE) // NOLINT
+         {
+            return res_t(err(column_error::open_failed));
+         }
+
+         LARGE_INTEGER size{};
+         if (not ::GetFileSizeEx(file, &size))
+         {
+            ::CloseHandle(file);
+            return res_t(err(column_error::open_failed));
+         }
+
+         if (size.QuadPart == 0)
+         {
+            ::CloseHandle(file);
+            return res_t(ok(mapped_file(nullptr, 0)));
+         }
+
+         HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+         ::CloseHandle(file);
+
+         if (mapping == nullptr)
+         {
+            return res_t(err(column_error::map_failed));
+         }
+
+         void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+         ::CloseHandle(mapping);
+
+         if (data == nullptr)
+         {
+            return res_t(err(column_error::map_failed));
+         }
+
+         return res_t(ok(mapped_file(static_cast<const std::byte*>(data),
+                                     static_cast<std::size_t>(size.QuadPart))));
+#else
+         const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // NOLINT
+         if (fd == -1)
+         {
+            return res_t(err(column_error::open_failed));
+         }
+
+         struct stat info = {};
+         if (::fstat(fd, &info) == -1)
+         {
+            ::close(fd);
+            return res_t(err(column_error::open_failed));
+         }
+
+         const auto size = static_cast<std::size_t>(info.st_size);
+         if (size == 0)
+         {
+            ::close(fd);
+            return res_t(ok(mapped_file(nullptr, 0)));
+         }
+
+         void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+         ::close(fd);
+
+         if (data == MAP_FAILED) // NOLINT
+         {
+            return res_t(err(column_error::map_failed));
+         }
+
+         if (hint == access_hint::sequential)
+         {
+            ::madvise(data, size, MADV_SEQUENTIAL);
+         }
+         else if (hint == access_hint::random)
+         {
+            ::madvise(data, size, MADV_RANDOM);
+         }
+
+         return res_t(ok(mapped_file(static_cast<const std::byte*>(data), size)));
+#endif
+      }
+
+   public:
+      mapped_file(const mapped_file&) = delete;
+      mapped_file(mapped_file&& other) noexcept :
+         m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0))
+      {}
+      ~mapped_file() { unmap(); }
+
+      auto operator=(const mapped_file&) -> mapped_file& = delete;
+      auto operator=(mapped_file&& rhs) noexcept -> mapped_file&
+      {
+         if (this != &rhs)
+         {
+            unmap();
+
+            m_data = std::exchange(rhs.m_data, nullptr);
+            m_size = std::exchange(rhs.m_size, 0);
+         }
+
+         return *this;
+      }
+
+      [[nodiscard]] auto bytes() const noexcept -> std::span<const std::byte>
+      {
+         return {m_data, m_size};
+      }
+
+   private:
+      mapped_file(const std::byte* data, std::size_t size) noexcept : m_data(data), m_size(size) {}
+
+      void unmap() noexcept
+      {
+         if (m_data == nullptr)
+         {
+            return;
+         }
+
+#if defined(_WIN32)
+         ::UnmapViewOfFile(m_data);
+#else
+         ::munmap(const_cast<std::byte*>(m_data), m_size); // NOLINT
+#endif
+      }
+
+   private:
+      const std::byte* m_data = nullptr;
+      std::size_t m_size = 0;
+   };
+
+   namespace detail
+   {
+      enum struct column_kind : std::uint8_t
+      {
+         maybe = 0,
+         result = 1
+      };
+
+      struct column_header
+      {
+         column_kind kind;
+         std::uint32_t value_size;
+         std::uint32_t error_size;
+         std::uint64_t array_offset;
+         std::uint64_t array_size;
+         std::uint64_t rank_index_offset;
+         std::uint64_t rank_index_size;
+      };
+
+      template <typename Monad>
+      struct column_traits;
+
+      template <trivial_payload T>
+      struct column_traits<maybe<T>>
+      {
+         using view_type = maybe_array_view<T>;
+
+         static constexpr column_kind kind = column_kind::maybe;
+         static constexpr std::uint32_t value_size = sizeof(T);
+         static constexpr std::uint32_t error_size = 0;
+
+         static auto view(std::span<const std::byte> array, std::span<const std::byte>)
+         {
+            return view_type::from(array);
+         }
+      };
+
+      template <trivial_payload T, trivial_payload E>
+      struct column_traits<result<T, E>>
+      {
+         using view_type = result_array_view<T, E>;
+
+         static constexpr column_kind kind = column_kind::result;
+         static constexpr std::uint32_t value_size = sizeof(T);
+         static constexpr std::uint32_t error_size = sizeof(E);
+
+         static auto view(std::span<const std::byte> array, std::span<const std::byte> rank_index)
+         {
+            return view_type::from(array, rank_index);
+         }
+      };
+
+      inline void write_column_header(std::ostream& os, const column_header& header)
+      {
+         std::vector<std::byte> buffer;
+         byte_writer writer(buffer);
+
+         const auto kind = static_cast<std::uint8_t>(header.kind);
+
+         writer.write(column_magic.data(), std::size(column_magic));
+         writer.write(&column_version, sizeof(column_version));
+         writer.write(&kind, sizeof(kind));
+         writer.pad_to(sizeof(std::uint32_t), 0);
+         writer.write(&header.value_size, sizeof(header.value_size));
+         writer.write(&header.error_size, sizeof(header.error_size));
+         writer.write(&header.array_offset, sizeof(header.array_offset));
+         writer.write(&header.array_size, sizeof(header.array_size));
+         writer.write(&header.rank_index_offset, sizeof(header.rank_index_offset));
+         writer.write(&header.rank_index_size, sizeof(header.rank_index_size));
+         writer.pad_to(column_header_size, 0);
+
+         os.write(reinterpret_cast<const char*>(buffer.data()), // NOLINT
+                  static_cast<std::streamsize>(std::size(buffer)));
+      }
+
+      inline auto read_column_header(std::span<const std::byte> in)
+         -> result<column_header, column_error>
+      {
+         byte_reader reader(in);
+
+         std::array<char, 8> magic = {};
+         std::uint32_t version = 0;
+         std::uint8_t kind = 0;
+         column_header header = {};
+
+         if (not reader.read(magic.data(), std::size(magic)) or
+             not reader.read(&version, sizeof(version)) or
+             not reader.read(&kind, sizeof(kind)) or
+             not reader.skip_padding(sizeof(std::uint32_t), 0) or
+             not reader.read(&header.value_size, sizeof(header.value_size)) or
+             not reader.read(&header.error_size, sizeof(header.error_size)) or
+             not reader.read(&header.array_offset, sizeof(header.array_offset)) or
+             not reader.read(&header.array_size, sizeof(header.array_size)) or
+             not reader.read(&header.rank_index_offset, sizeof(header.rank_index_offset)) or
+             not reader.read(&header.rank_index_size, sizeof(header.rank_index_size)))
+         {
+            return err(column_error::truncated);
+         }
+
+         if (magic != column_magic)
+         {
+            return err(column_error::invalid_magic);
+         }
+
+         if (version != column_version)
+         {
+            return err(column_error::unsupported_version);
+         }
+
+         header.kind = static_cast<column_kind>(kind);
+
+         const auto fits = [&](std::uint64_t offset, std::uint64_t size) {
+            return offset <= std::size(in) and size <= std::size(in) - offset;
+         };
+
+         if (not fits(header.array_offset, header.array_size) or
+             not fits(header.rank_index_offset, header.rank_index_size))
+         {
+            return err(column_error::truncated);
+         }
+
+         return ok(header);
+      }
+   } // namespace detail
+
+   /**
+    * @brief Write a column file holding an array of maybes: a header naming the monad & the size
+    * of its payloads, followed by the array as encoded by 'encode_array'.
+    */
+   template <detail::trivial_payload T>
+   void write_column(std::ostream& os, std::span<const maybe<T>> values)
+   {
+      std::vector<std::byte> array;
+      encode_array(array, values);
+
+      detail::write_column_header(os, {.kind = detail::column_kind::maybe,
+                                       .value_size = sizeof(T),
+                                       .error_size = 0,
+                                       .array_offset = column_header_size,
+                                       .array_size = std::size(array),
+                                       .rank_index_offset = column_header_size + std::size(array),
+                                       .rank_index_size = 0});
+
+      os.write(reinterpret_cast<const char*>(array.data()), // NOLINT
+               static_cast<std::streamsize>(std::size(array)));
+   }
+
+   /**
+    * @brief Write a column file holding an array of results: a header naming the monad & the
+    * size of its payloads, followed by the array as encoded by 'encode_array' & its rank index,
+    * which lets readers find any error in constant time.
+    */
+   template <detail::trivial_payload T, detail::trivial_payload E>
+   void write_column(std::ostream& os, std::span<const result<T, E>> values)
+   {
+      std::vector<std::byte> body;
+      encode_array(body, values);
+
+      const std::size_t array_size = std::size(body);
+
+      byte_writer writer(body);
+      writer.pad_to(array_section_alignment, 0);
+
+      const std::size_t rank_index_offset = std::size(body);
+      encode_rank_index(body, values);
+
+      detail::write_column_header(
+         os, {.kind = detail::column_kind::result,
+              .value_size = sizeof(T),
+              .error_size = sizeof(E),
+              .array_offset = column_header_size,
+              .array_size = array_size,
+              .rank_index_offset = column_header_size + rank_index_offset,
+              .rank_index_size = std::size(body) - rank_index_offset});
+
+      os.write(reinterpret_cast<const char*>(body.data()), // NOLINT
+               static_cast<std::streamsize>(std::size(body)));
+   }
+
+   /**
+    * @brief A column file mapped in memory, read as a random access range of 'Monad' without
+    * deserializing it. Elements are loaded by value from the mapping as they are accessed, so
+    * opening a column only reads its header, its bitmap & its rank index, which are checked
+    * against each other. Moving a column invalidates its iterators.
+    */
+   template <typename Monad>
+   class mapped_column
+   {
+      using traits = detail::column_traits<Monad>;
+
+   public:
+      using view_type = typename traits::view_type;
+      using iterator = typename view_type::iterator;
+
+   public:
+      /**
+       * @brief Map the column file at 'path', checking that it holds an array of 'Monad'.
+       */
+      static auto open(const std::filesystem::path& path, access_hint hint = access_hint::normal)
+      {
+         using res_t = result<mapped_column, column_error>;
+
+         auto file = mapped_file::open(path, hint);
+         if (file.is_err())
+         {
+            return res_t(err(file.borrow_err()));
+         }
+
+         const std::span<const std::byte> bytes = file.borrow().bytes();
+
+         const auto header = detail::read_column_header(bytes);
+         if (header.is_err())
+         {
+            return res_t(err(header.borrow_err()));
+         }
+
+         const detail::column_header& info = header.borrow();
+         if (info.kind != traits::kind or info.value_size != traits::value_size or
+             info.error_size != traits::error_size)
+         {
+            return res_t(err(column_error::type_mismatch));
+         }
+
+         const auto view = traits::view(
+            bytes.subspan(static_cast<std::size_t>(info.array_offset),
+                          static_cast<std::size_t>(info.array_size)),
+            bytes.subspan(static_cast<std::size_t>(info.rank_index_offset),
+                          static_cast<std::size_t>(info.rank_index_size)));
+         if (view.is_err())
+         {
+            return res_t(err(view.borrow_err() == decode_error::corrupted
+                                ? column_error::corrupted
+                                : column_error::truncated));
+         }
+
+         return res_t(ok(mapped_column(std::move(file).take(), view.borrow())));
+      }
+
+   public:
+      [[nodiscard]] auto size() const noexcept -> std::size_t { return m_view.size(); }
+      [[nodiscard]] auto empty() const noexcept -> bool { return m_view.empty(); }
+
+      [[nodiscard]] auto begin() const noexcept -> iterator { return m_view.begin(); }
+      [[nodiscard]] auto end() const noexcept -> iterator { return m_view.end(); }
+
+      /**
+       * @brief Load the element at 'index', which must be less than 'size()'.
+       */
+      [[nodiscard]] auto operator[](std::size_t index) const -> Monad { return m_view[index]; }
+
+      [[nodiscard]] auto view() const noexcept -> const view_type& { return m_view; }
+
+   private:
+      mapped_column(mapped_file&& file, const view_type& view) noexcept :
+         m_file(std::move(file)), m_view(view)
+      {}
+
+   private:
+      mapped_file m_file;
+      view_type m_view;
+   };
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_COLUMN_FILE_HPP
@@ -0,0 +1,257 @@
+/**
+ * @file compact_errc.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Contains compact_errc, an error code packed with the id of its category in 32 bits
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_COMPACT_ERRC_HPP
+#define LIBREGLISSE_COMPACT_ERRC_HPP
+
+#include <libreglisse/maybe.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      inline constexpr std::uint8_t generic_category_id = 0;
+      inline constexpr std::uint8_t system_category_id = 1;
+      inline constexpr std::size_t max_error_categories = 256;
+
+      /**
+       * @brief The categories registered by 'compact_errc', indexed by their id. Slots are
+       * claimed once & never released, so ids stay valid for the lifetime of the process.
+       */
+      inline std::array<std::atomic<const std::error_category*>, max_error_categories>
+         error_categories{}; // NOLINT
+
+      /**
+       * @brief Find the id of 'category', registering it if it has none yet.
+       *
+       * @returns The id of the category, or none if every id is already taken.
+       */
+      inline auto error_category_id(const std::error_category& category) -> maybe<std::uint8_t>
+      {
+         if (category == std::generic_category())
+         {
+            return some(generic_category_id);
+         }
+
+         if (category == std::system_category())
+         {
+            return some(system_category_id);
+         }
+
+         for (std::size_t i = system_category_id + 1; i < max_error_categories; ++i)
+         {
+            const std::error_category* slot = error_categories[i].load(std::memory_order_acquire);
+            if (slot == nullptr and
+                error_categories[i].compare_exchange_strong(slot, &category,
+                                                            std::memory_order_acq_rel))
+            {
+               return some(static_cast<std::uint8_t>(i));
+            }
+
+            if (*slot == category)
+            {
+               return some(static_cast<std::uint8_t>(i));
+            }
+         }
+
+         return none;
+      }
+
+      /**
+       * @brief The category of codes whose id is not registered in this process, such as codes
+       * whose bits were copied from another process.
+       */
+      class unknown_error_category : public std::error_category
+      {
+      public:
+         [[nodiscard]] auto name() const noexcept -> const char* override { return "unknown"; }
+         [[nodiscard]] auto message(int) const -> std::string override
+         {
+            return "unknown error category";
+         }
+      };
+
+      inline auto unknown_category() noexcept -> const std::error_category&
+      {
+         static const unknown_error_category category;
+         return category;
+      }
+
+      /**
+       * @brief Find the category registered with 'id', or the unknown category if there is none.
+       */
+      inline auto error_category_from_id(std::uint8_t id) noexcept -> const std::error_category&
+      {
+         if (id == generic_category_id)
+         {
+            return std::generic_category();
+         }
+
+         if (id == system_category_id)
+         {
+            return std::system_category();
+         }
+
+         const std::error_category* category = error_categories[id].load(std::memory_order_acquire);
+         if (category == nullptr)
+         {
+            return unknown_category();
+         }
+
+         return *category;
+      }
+   } // namespace detail
+
+   /**
+    * @brief An error code packed with the id of its category in 32 bits, so a
+    * 'result<int, compact_errc>' fits in 8 bytes where one holding a 'std::error_code' takes 16.
+    *
+    * The code is stored on 24 bits & the category id on 8. Categories are given ids from a
+    * process wide registry the first time a code of theirs is converted, 'std::generic_category'
+    * & 'std::system_category' being known ahead of time. Codes that do not fit & categories that
+    * cannot be registered are refused, so every 'compact_errc' converts back to the
+    * 'std::error_code' it was made from. It is trivially copyable & never allocates.
+    *
+    * Category ids are handed out in the order categories are first used, so they are only
+    * meaningful in the process that registered them & a 'compact_errc' is not serializable. Bits
+    * holding an id that is not registered, copied from elsewhere, report an "unknown" category.
+    */
+   class compact_errc
+   {
+   public:
+      using process_local = void;
+
+      static constexpr std::int32_t min_value = -(1 << 23);    // NOLINT
+      static constexpr std::int32_t max_value = (1 << 23) - 1; // NOLINT
+
+   public:
+      /**
+       * @brief Construct the code of success in the generic category.
+       */
+      constexpr compact_errc() noexcept = default;
+      /**
+       * @brief Construct from a portable error condition of the generic category.
+       */
+      constexpr compact_errc(std::errc code) noexcept :
+         compact_errc(static_cast<std::int32_t>(code), detail::generic_category_id)
+      {}
+
+      /**
+       * @brief Pack a std::error_code, registering its category if needed.
+       *
+       * @returns The packed code, or none if its value does not fit on 24 bits or its category
+       * could not be registered.
+       */
+      static auto from(const std::error_code& code) -> maybe<compact_errc>
+      {
+         if (not fits(code.value()))
+         {
+            return none;
+         }
+
+         const maybe<std::uint8_t> id = detail::error_category_id(code.category());
+         if (id.is_none())
+         {
+            return none;
+         }
+
+         return some(compact_errc(code.value(), id.borrow()));
+      }
+      /**
+       * @brief Pack an errno value in the generic category.
+       *
+       * @returns The packed code, or none if it does not fit on 24 bits.
+       */
+      static constexpr auto from_errno(int code) noexcept -> maybe<compact_errc>
+      {
+         if (not fits(code))
+         {
+            return none;
+         }
+
+         return some(compact_errc(code, detail::generic_category_id));
+      }
+
+      [[nodiscard]] constexpr auto value() const noexcept -> int
+      {
+         return static_cast<std::int32_t>(m_bits) >> 8; // NOLINT
+      }
+      [[nodiscard]] constexpr auto category_id() const noexcept -> std::uint8_t
+      {
+         return static_cast<std::uint8_t>(m_bits & 0xFFU); // NOLINT
+      }
+      [[nodiscard]] auto category() const noexcept -> const std::error_category&
+      {
+         return detail::error_category_from_id(category_id());
+      }
+
+      [[nodiscard]] auto to_error_code() const noexcept -> std::error_code
+      {
+         return {value(), category()};
+      }
+      /**
+       * @brief Get the errno value equivalent to the code, found through the default error
+       * condition of its category.
+       *
+       * @returns The errno value, or none if the code maps to no portable condition.
+       */
+      [[nodiscard]] auto to_errno() const noexcept -> maybe<int>
+      {
+         const std::error_condition condition = category().default_error_condition(value());
+         if (condition.category() != std::generic_category())
+         {
+            return none;
+         }
+
+         return some(condition.value());
+      }
+      /**
+       * @brief Map the code to the generic category through the default error condition of its
+       * category, leaving it as is if it maps to no portable condition. Meant to be given to
+       * 'transform_err' to merge the errors of several categories.
+       */
+      [[nodiscard]] auto to_generic() const noexcept -> compact_errc
+      {
+         const maybe<int> code = to_errno();
+         if (code.is_none())
+         {
+            return *this;
+         }
+
+         return from_errno(code.borrow()).take_or(*this);
+      }
+
+      [[nodiscard]] auto message() const -> std::string { return category().message(value()); }
+
+      constexpr explicit operator bool() const noexcept { return value() != 0; }
+
+      constexpr auto operator==(const compact_errc&) const noexcept -> bool = default;
+
+   private:
+      constexpr compact_errc(std::int32_t value, std::uint8_t category_id) noexcept :
+         m_bits((static_cast<std::uint32_t>(value) << 8U) | category_id) // NOLINT
+      {}
+
+      static constexpr auto fits(int code) noexcept -> bool
+      {
+         return code >= min_value and code <= max_value;
+      }
+
+   private:
+      std::uint32_t m_bits = 0;
+   };
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_COMPACT_ERRC_HPP
@@ -0,0 +1,114 @@
+/**
+ * @file detail/monad_access.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Helpers to access the content of any type modeling the monad concepts
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_DETAIL_MONAD_ACCESS_HPP
+#define LIBREGLISSE_DETAIL_MONAD_ACCESS_HPP
+
+#include <libreglisse/concepts.hpp>
+
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0::detail
+{
+   /**
+    * @brief Access the value of a maybe or result monad according to its value category.
+    *
+    * Lvalues are borrowed when the monad allows it, rvalues are always taken.
+    */
+   template <typename Monad>
+   constexpr auto forward_value(Monad&& m) -> decltype(auto)
+   {
+      if constexpr (not std::is_lvalue_reference_v<Monad>)
+      {
+         return std::move(m).take();
+      }
+      else if constexpr (requires { m.borrow(); })
+      {
+         return m.borrow();
+      }
+      else
+      {
+         return std::decay_t<Monad>(m).take();
+      }
+   }
+
+   /**
+    * @brief Access the error of a result monad according to its value category.
+    */
+   template <typename Monad>
+   constexpr auto forward_error(Monad&& m) -> decltype(auto)
+   {
+      if constexpr (not std::is_lvalue_reference_v<Monad>)
+      {
+         return std::move(m).take_err();
+      }
+      else if constexpr (requires { m.borrow_err(); })
+      {
+         return m.borrow_err();
+      }
+      else
+      {
+         return std::decay_t<Monad>(m).take_err();
+      }
+   }
+
+   /**
+    * @brief Access the left value of an either monad according to its value category.
+    */
+   template <typename Monad>
+   constexpr auto forward_left(Monad&& m) -> decltype(auto)
+   {
+      if constexpr (not std::is_lvalue_reference_v<Monad>)
+      {
+         return std::move(m).take_left();
+      }
+      else if constexpr (requires { m.borrow_left(); })
+      {
+         return m.borrow_left();
+      }
+      else
+      {
+         return std::decay_t<Monad>(m).take_left();
+      }
+   }
+
+   /**
+    * @brief Access the right value of an either monad according to its value category.
+    */
+   template <typename Monad>
+   constexpr auto forward_right(Monad&& m) -> decltype(auto)
+   {
+      if constexpr (not std::is_lvalue_reference_v<Monad>)
+      {
+         return std::move(m).take_right();
+      }
+      else if constexpr (requires { m.borrow_right(); })
+      {
+         return m.borrow_right();
+      }
+      else
+      {
+         return std::decay_t<Monad>(m).take_right();
+      }
+   }
+
+   template <typename Monad>
+   using forward_value_t = decltype(forward_value(std::declval<Monad>()));
+
+   template <typename Monad>
+   using forward_error_t = decltype(forward_error(std::declval<Monad>()));
+
+   template <typename Monad>
+   using forward_left_t = decltype(forward_left(std::declval<Monad>()));
+
+   template <typename Monad>
+   using forward_right_t = decltype(forward_right(std::declval<Monad>()));
+} // namespace reglisse::v0::detail
+
+#endif // LIBREGLISSE_DETAIL_MONAD_ACCESS_HPP
@@ -0,0 +1,419 @@
+/**
+ * @file detail/ring_buffer.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Bounded lock-free ring buffers used by the concurrent queues
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_DETAIL_RING_BUFFER_HPP
+#define LIBREGLISSE_DETAIL_RING_BUFFER_HPP
+
+#include <libreglisse/maybe.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0::detail
+{
+   /**
+    * @brief The size of a cache line on the targeted platforms.
+    *
+    * 'std::hardware_destructive_interference_size' is not used since its value may change
+    * between compiler flags, which would change the layout of the queues across translation
+    * units.
+    */
+   inline constexpr std::size_t cache_line_size = 64;
+
+   /**
+    * @brief Uninitialized storage for a single element of a ring buffer.
+    */
+   template <typename T>
+   union ring_storage
+   {
+      constexpr ring_storage() noexcept {} // NOLINT
+      constexpr ~ring_storage() {}         // NOLINT
+
+      ring_storage(const ring_storage&) = delete;
+      ring_storage(ring_storage&&) = delete;
+
+      auto operator=(const ring_storage&) -> ring_storage& = delete;
+      auto operator=(ring_storage&&) -> ring_storage& = delete;
+
+      T value;
+   };
+
+   template <typename T>
+   concept ring_element = std::is_nothrow_move_constructible_v<T> and
+      std::is_nothrow_destructible_v<T>;
+
+   /**
+    * @brief A bounded single producer, single consumer ring buffer.
+    *
+    * The producer & consumer indices live on their own cache line alongside a cached copy of
+    * the other side's index, so that the shared indices are only read when the ring looks full
+    * or empty.
+    */
+   template <ring_element T>
+   class spsc_ring
+   {
+   public:
+      using value_type = T;
+
+   public:
+      /**
+       * @brief Construct a ring able to hold at least 'capacity' elements.
+       *
+       * The capacity is rounded up to the next power of two.
+       */
+      explicit spsc_ring(std::size_t capacity) :
+         m_mask(std::bit_ceil(std::max(capacity, std::size_t{1})) - 1),
+         m_buffer(std::make_unique<ring_storage<value_type>[]>(m_mask + 1))
+      {}
+      spsc_ring(const spsc_ring&) = delete;
+      spsc_ring(spsc_ring&&) = delete;
+      ~spsc_ring()
+      {
+         if constexpr (not std::is_trivially_destructible_v<value_type>)
+         {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+            for (std::size_t i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+            {
+               std::destroy_at(&m_buffer[i & m_mask].value);
+            }
+         }
+      }
+
+      auto operator=(const spsc_ring&) -> spsc_ring& = delete;
+      auto operator=(spsc_ring&&) -> spsc_ring& = delete;
+
+      /**
+       * @brief Construct a value at the back of the ring. Must only be called by the producer.
+       *
+       * @param [in] args The arguments used to construct the value. They are only consumed on
+       * success.
+       *
+       * @return false if the ring was full.
+       */
+      template <typename... Args>
+         requires std::is_nothrow_constructible_v<value_type, Args...>
+      auto try_emplace(Args&&... args) noexcept -> bool
+      {
+         const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+         if (tail - m_cached_head > m_mask)
+         {
+            m_cached_head = m_head.load(std::memory_order_acquire);
+
+            if (tail - m_cached_head > m_mask)
+            {
+               return false;
+            }
+         }
+
+         std::construct_at(&m_buffer[tail & m_mask].value, std::forward<Args>(args)...);
+         m_tail.store(tail + 1, std::memory_order_release);
+
+         return true;
+      }
+
+      /**
+       * @brief Pop the value at the front of the ring. Must only be called by the consumer.
+       *
+       * @return The popped value or none if the ring was empty.
+       */
+      auto try_pop() noexcept -> maybe<value_type>
+      {
+         const std::size_t head = m_head.load(std::memory_order_relaxed);
+
+         if (head == m_cached_tail)
+         {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+            if (head == m_cached_tail)
+            {
+               return none;
+            }
+         }
+
+         value_type& slot = m_buffer[head & m_mask].value;
+         maybe<value_type> res = some(std::move(slot));
+         std::destroy_at(&slot);
+
+         m_head.store(head + 1, std::memory_order_release);
+
+         return res;
+      }
+
+      /**
+       * @brief Move up to 'out.size()' values from the front of the ring into 'out'. Must only
+       * be called by the consumer.
+       *
+       * The consumer index is published once for the whole batch.
+       *
+       * @return The number of values popped.
+       */
+      auto pop_n(std::span<value_type> out) noexcept -> std::size_t
+         requires std::is_nothrow_move_assignable_v<value_type>
+      {
+         const std::size_t head = m_head.load(std::memory_order_relaxed);
+
+         if (m_cached_tail - head < out.size())
+         {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+         }
+
+         const std::size_t count = std::min(m_cached_tail - head, out.size());
+
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            value_type& slot = m_buffer[(head + i) & m_mask].value;
+            out[i] = std::move(slot);
+            std::destroy_at(&slot);
+         }
+
+         if (count != 0)
+         {
+            m_head.store(head + count, std::memory_order_release);
+         }
+
+         return count;
+      }
+
+      [[nodiscard]] auto capacity() const noexcept -> std::size_t { return m_mask + 1; }
+      /**
+       * @brief The number of values pushed in the ring since its construction.
+       */
+      [[nodiscard]] auto pushed() const noexcept -> std::size_t
+      {
+         return m_tail.load(std::memory_order_relaxed);
+      }
+
+   private:
+      std::size_t m_mask;
+      std::unique_ptr<ring_storage<value_type>[]> m_buffer;
+
+      alignas(cache_line_size) std::atomic<std::size_t> m_head{0};
+      std::size_t m_cached_tail{0};
+
+      alignas(cache_line_size) std::atomic<std::size_t> m_tail{0};
+      std::size_t m_cached_head{0};
+   };
+
+   /**
+    * @brief A bounded multiple producers, multiple consumers ring buffer.
+    *
+    * Each cell carries a sequence number telling whether it is ready to be written to or read
+    * from for a given lap around the ring, as described by Dmitry Vyukov.
+    */
+   template <ring_element T>
+   class mpmc_ring
+   {
+      struct cell
+      {
+         std::atomic<std::size_t> sequence;
+         ring_storage<T> storage;
+      };
+
+   public:
+      using value_type = T;
+
+   public:
+      /**
+       * @brief Construct a ring able to hold at least 'capacity' elements.
+       *
+       * The capacity is rounded up to the next power of two.
+       */
+      explicit mpmc_ring(std::size_t capacity) :
+         m_mask(std::bit_ceil(std::max(capacity, std::size_t{1})) - 1),
+         m_buffer(std::make_unique<cell[]>(m_mask + 1))
+      {
+         for (std::size_t i = 0; i <= m_mask; ++i)
+         {
+            m_buffer[i].sequence.store(i, std::memory_order_relaxed);
+         }
+      }
+      mpmc_ring(const mpmc_ring&) = delete;
+      mpmc_ring(mpmc_ring&&) = delete;
+      ~mpmc_ring()
+      {
+         if constexpr (not std::is_trivially_destructible_v<value_type>)
+         {
+            const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+            for (std::size_t i = m_head.load(std::memory_order_relaxed); i != tail; ++i)
+            {
+               std::destroy_at(&m_buffer[i & m_mask].storage.value);
+            }
+         }
+      }
+
+      auto operator=(const mpmc_ring&) -> mpmc_ring& = delete;
+      auto operator=(mpmc_ring&&) -> mpmc_ring& = delete;
+
+      /**
+       * @brief Construct a value at the back of the ring.
+       *
+       * @param [in] args The arguments used to construct the value. They are only consumed on
+       * success.
+       *
+       * @return false if the ring was full.
+       */
+      template <typename... Args>
+         requires std::is_nothrow_constructible_v<value_type, Args...>
+      auto try_emplace(Args&&... args) noexcept -> bool
+      {
+         std::size_t tail = m_tail.load(std::memory_order_relaxed);
+
+         while (true)
+         {
+            cell& c = m_buffer[tail & m_mask];
+            const std::size_t sequence = c.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - tail);
+
+            if (diff == 0)
+            {
+               if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+               {
+                  std::construct_at(&c.storage.value, std::forward<Args>(args)...);
+                  c.sequence.store(tail + 1, std::memory_order_release);
+
+                  return true;
+               }
+            }
+            else if (diff < 0)
+            {
+               return false;
+            }
+            else
+            {
+               tail = m_tail.load(std::memory_order_relaxed);
+            }
+         }
+      }
+
+      /**
+       * @brief Pop the value at the front of the ring.
+       *
+       * @return The popped value or none if the ring was empty.
+       */
+      auto try_pop() noexcept -> maybe<value_type>
+      {
+         std::size_t head = m_head.load(std::memory_order_relaxed);
+
+         while (true)
+         {
+            cell& c = m_buffer[head & m_mask];
+            const std::size_t sequence = c.sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence - (head + 1));
+
+            if (diff == 0)
+            {
+               if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+               {
+                  return release(c, head);
+               }
+            }
+            else if (diff < 0)
+            {
+               return none;
+            }
+            else
+            {
+               head = m_head.load(std::memory_order_relaxed);
+            }
+         }
+      }
+
+      /**
+       * @brief Move up to 'out.size()' values from the front of the ring into 'out'.
+       *
+       * The values are claimed with a single update of the consumer index, so a batch is
+       * always made of consecutive values.
+       *
+       * @return The number of values popped.
+       */
+      auto pop_n(std::span<value_type> out) noexcept -> std::size_t
+         requires std::is_nothrow_move_assignable_v<value_type>
+      {
+         std::size_t head = m_head.load(std::memory_order_relaxed);
+         std::size_t count = 0;
+
+         while (true)
+         {
+            count = 0;
+            while (count < out.size())
+            {
+               const std::size_t index = head + count;
+               const std::size_t sequence =
+                  m_buffer[index & m_mask].sequence.load(std::memory_order_acquire);
+
+               if (sequence != index + 1)
+               {
+                  break;
+               }
+
+               ++count;
+            }
+
+            if (count == 0)
+            {
+               const std::size_t current = m_head.load(std::memory_order_relaxed);
+               if (current == head)
+               {
+                  return 0;
+               }
+
+               head = current;
+            }
+            else if (m_head.compare_exchange_weak(head, head + count, std::memory_order_relaxed))
+            {
+               break;
+            }
+         }
+
+         for (std::size_t i = 0; i < count; ++i)
+         {
+            cell& c = m_buffer[(head + i) & m_mask];
+            out[i] = std::move(c.storage.value);
+            std::destroy_at(&c.storage.value);
+            c.sequence.store(head + i + m_mask + 1, std::memory_order_release);
+         }
+
+         return count;
+      }
+
+      [[nodiscard]] auto capacity() const noexcept -> std::size_t { return m_mask + 1; }
+      /**
+       * @brief The number of values pushed in the ring since its construction.
+       */
+      [[nodiscard]] auto pushed() const noexcept -> std::size_t
+      {
+         return m_tail.load(std::memory_order_relaxed);
+      }
+
+   private:
+      auto release(cell& c, std::size_t head) noexcept -> maybe<value_type>
+      {
+         maybe<value_type> res = some(std::move(c.storage.value));
+         std::destroy_at(&c.storage.value);
+         c.sequence.store(head + m_mask + 1, std::memory_order_release);
+
+         return res;
+      }
+
+   private:
+      std::size_t m_mask;
+      std::unique_ptr<cell[]> m_buffer;
+
+      alignas(cache_line_size) std::atomic<std::size_t> m_head{0};
+      alignas(cache_line_size) std::atomic<std::size_t> m_tail{0};
+   };
+} // namespace reglisse::v0::detail
+
+#endif // LIBREGLISSE_DETAIL_RING_BUFFER_HPP
@@ -15,8 +15,11 @@
 #   include <cassert>
 #endif // defined (LIBREGLISSE_USE_EXCEPTIONS)
 
+#include <libreglisse/relocate.hpp>
+
 #include <algorithm>
 #include <concepts>
+#include <functional>
 
 namespace reglisse::inline v0
 {
@@ -224,7 +227,7 @@ namespace reglisse::inline v0
        */
       constexpr either(left<left_type>&& left_val)
       {
-         std::construct_at(&m_left, std::move(left_val).take()); // NOLINT
+         std::construct_at(&m_left, std::move(left_val.borrow())); // NOLINT
       }
       /**
        * @brief Construct from a right either.
@@ -233,8 +236,14 @@ namespace reglisse::inline v0
        */
       constexpr either(right<right_type>&& right_val) : m_is_left(false)
       {
-         std::construct_at(&m_right, std::move(right_val).take()); // NOLINT
+         std::construct_at(&m_right, std::move(right_val.borrow())); // NOLINT
       }
+      /**
+       * @brief Trivially copy construct an either.
+       */
+      constexpr either(const either&)
+         requires detail::trivially_copy_constructible<left_type, right_type>
+      = default;
       /**
        * @brief Copy construct an either
        */
@@ -249,6 +258,12 @@ namespace reglisse::inline v0
             std::construct_at(&m_right, other.borrow_right()); // NOLINT
          }
       }
+      /**
+       * @brief Trivially move construct an either.
+       */
+      constexpr either(either&&) noexcept
+         requires detail::trivially_move_constructible<left_type, right_type>
+      = default;
       /**
        * @brief Move construct an either
        */
@@ -256,13 +271,17 @@ namespace reglisse::inline v0
       {
          if (is_left())
          {
-            std::construct_at(&m_left, other.take_left()); // NOLINT
+            std::construct_at(&m_left, std::move(other.m_left)); // NOLINT
          }
          else
          {
-            std::construct_at(&m_right, other.take_right()); // NOLINT
+            std::construct_at(&m_right, std::move(other.m_right)); // NOLINT
          }
       }
+      /**
+       * @brief Trivially destroy an either.
+       */
+      constexpr ~either() requires detail::trivially_destructible<left_type, right_type> = default;
       /**
        * @brief Destruct either.
        */
@@ -278,55 +297,112 @@ namespace reglisse::inline v0
          }
       }
 
+      /**
+       * @brief Trivially copy assign an either.
+       */
+      constexpr auto operator=(const either&) -> either&
+         requires detail::trivially_copy_assignable<left_type, right_type>
+      = default;
+      /**
+       * @brief Copy assign an either.
+       *
+       * If both monads hold the same alternative, it is assigned in place to reuse its storage.
+       */
       constexpr auto operator=(const either& rhs) -> either&
       {
          if (this != &rhs)
          {
-            if (is_left())
+            if (is_left() && rhs.is_left())
             {
-               std::destroy_at(&m_left); // NOLINT
+               if constexpr (std::is_copy_assignable_v<left_type>)
+               {
+                  m_left = rhs.m_left; // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_left);               // NOLINT
+                  std::construct_at(&m_left, rhs.m_left); // NOLINT
+               }
             }
-            else
+            else if (is_right() && rhs.is_right())
             {
-               std::destroy_at(&m_right); // NOLINT
+               if constexpr (std::is_copy_assignable_v<right_type>)
+               {
+                  m_right = rhs.m_right; // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_right);                // NOLINT
+                  std::construct_at(&m_right, rhs.m_right); // NOLINT
+               }
             }
-
-            m_is_left = rhs.m_is_left;
-
-            if (is_left())
+            else if (rhs.is_left())
             {
-               std::construct_at(&m_left, rhs.borrow_left()); // NOLINT
+               std::destroy_at(&m_right);              // NOLINT
+               std::construct_at(&m_left, rhs.m_left); // NOLINT
+               m_is_left = true;
             }
             else
             {
-               std::construct_at(&m_right, rhs.borrow_right()); // NOLINT
+               std::destroy_at(&m_left);                 // NOLINT
+               std::construct_at(&m_right, rhs.m_right); // NOLINT
+               m_is_left = false;
             }
          }
 
          return *this;
       }
+      /**
+       * @brief Trivially move assign an either.
+       */
+      constexpr auto operator=(either&&) noexcept -> either&
+         requires detail::trivially_move_assignable<left_type, right_type>
+      = default;
+      /**
+       * @brief Move assign an either.
+       *
+       * If both monads hold the same alternative, it is move assigned in place to reuse its
+       * storage.
+       */
       constexpr auto operator=(either&& rhs) noexcept -> either&
       {
          if (this != &rhs)
          {
-            if (is_left())
+            if (is_left() && rhs.is_left())
             {
-               std::destroy_at(&m_left); // NOLINT
+               if constexpr (std::is_move_assignable_v<left_type>)
+               {
+                  m_left = std::move(rhs.m_left); // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_left);                          // NOLINT
+                  std::construct_at(&m_left, std::move(rhs.m_left)); // NOLINT
+               }
             }
-            else
+            else if (is_right() && rhs.is_right())
             {
-               std::destroy_at(&m_right); // NOLINT
+               if constexpr (std::is_move_assignable_v<right_type>)
+               {
+                  m_right = std::move(rhs.m_right); // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_right);                           // NOLINT
+                  std::construct_at(&m_right, std::move(rhs.m_right)); // NOLINT
+               }
             }
-
-            m_is_left = rhs.m_is_left;
-
-            if (is_left())
+            else if (rhs.is_left())
             {
-               std::construct_at(&m_left, std::move(rhs).take_left()); // NOLINT
+               std::destroy_at(&m_right);                         // NOLINT
+               std::construct_at(&m_left, std::move(rhs.m_left)); // NOLINT
+               m_is_left = true;
             }
             else
             {
-               std::construct_at(&m_right, std::move(rhs).take_right()); // NOLINT
+               std::destroy_at(&m_left);                            // NOLINT
+               std::construct_at(&m_right, std::move(rhs.m_right)); // NOLINT
+               m_is_left = false;
             }
          }
 
@@ -474,6 +550,68 @@ namespace reglisse::inline v0
          return std::move(m_right); // NOLINT
       }
 
+      /**
+       * @brief Call 'on_left' with the value stored on the left of the monad, or 'on_right' with
+       * the value stored on the right.
+       *
+       * The discriminant is tested once and the value is handed over without the checks done by
+       * 'borrow_left' & 'borrow_right'. It is moved into the function if the monad is an rvalue.
+       *
+       * @param [in] on_left The function called with the value stored on the left.
+       * @param [in] on_right The function called with the value stored on the right.
+       *
+       * @returns The value returned by the function called, converted to the common type of both.
+       */
+      template <std::invocable<const left_type&> OnLeft, std::invocable<const right_type&> OnRight>
+      constexpr auto match(OnLeft&& on_left, OnRight&& on_right) const&
+         -> std::common_type_t<std::invoke_result_t<OnLeft, const left_type&>,
+                               std::invoke_result_t<OnRight, const right_type&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<OnLeft>(on_left), m_left); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnRight>(on_right), m_right); // NOLINT
+      }
+      template <std::invocable<left_type&> OnLeft, std::invocable<right_type&> OnRight>
+      constexpr auto match(OnLeft&& on_left, OnRight&& on_right) &
+         -> std::common_type_t<std::invoke_result_t<OnLeft, left_type&>,
+                               std::invoke_result_t<OnRight, right_type&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<OnLeft>(on_left), m_left); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnRight>(on_right), m_right); // NOLINT
+      }
+      template <std::invocable<const left_type&&> OnLeft,
+                std::invocable<const right_type&&> OnRight>
+      constexpr auto match(OnLeft&& on_left, OnRight&& on_right) const&&
+         -> std::common_type_t<std::invoke_result_t<OnLeft, const left_type&&>,
+                               std::invoke_result_t<OnRight, const right_type&&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<OnLeft>(on_left), std::move(m_left)); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnRight>(on_right), std::move(m_right)); // NOLINT
+      }
+      template <std::invocable<left_type&&> OnLeft, std::invocable<right_type&&> OnRight>
+      constexpr auto match(OnLeft&& on_left, OnRight&& on_right) &&
+         -> std::common_type_t<std::invoke_result_t<OnLeft, left_type&&>,
+                               std::invoke_result_t<OnRight, right_type&&>>
+      {
+         if (is_left())
+         {
+            return std::invoke(std::forward<OnLeft>(on_left), std::move(m_left)); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnRight>(on_right), std::move(m_right)); // NOLINT
+      }
+
       /**
        * @brief Check if the monad is storing a value on the left.
        *
@@ -525,6 +663,15 @@ namespace reglisse::inline v0
    {
       return lhs.is_right() ? lhs.borrow_right() == rhs : false;
    }
+
+   /**
+    * @brief An either is trivially relocatable when its payloads are.
+    */
+   template <typename LeftType, typename RightType>
+   struct is_trivially_relocatable<either<LeftType, RightType>> :
+      std::bool_constant<is_trivially_relocatable_v<LeftType> and
+                         is_trivially_relocatable_v<RightType>>
+   {};
 } // namespace reglisse::v0
 
 #endif // LIBREGLISSE_EITHER_HPP
@@ -0,0 +1,257 @@
+/**
+ * @file error_message.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Contains error message types that never allocate when constructed: literals kept in
+ * static storage & messages interned in a process wide table
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_ERROR_MESSAGE_HPP
+#define LIBREGLISSE_ERROR_MESSAGE_HPP
+
+#include <libreglisse/result.hpp>
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      /**
+       * @brief Not constexpr, so calling it while building an 'err_literal' fails to compile.
+       */
+      inline void literal_is_not_null_terminated() {}
+   } // namespace detail
+
+   /**
+    * @brief An error message referring to a string literal. It may only be built from a null
+    * terminated array at compile time, so the message it refers to lives for the whole program.
+    *
+    * It refers to memory of the process that built it, so it is not serializable.
+    */
+   class err_literal
+   {
+   public:
+      using process_local = void;
+
+   public:
+      template <std::size_t Size>
+      consteval err_literal(const char (&message)[Size]) noexcept : // NOLINT
+         m_message(message, Size - 1)
+      {
+         if (message[Size - 1] != '\0')
+         {
+            detail::literal_is_not_null_terminated();
+         }
+      }
+
+      [[nodiscard]] constexpr auto c_str() const noexcept -> const char*
+      {
+         return m_message.data();
+      }
+      [[nodiscard]] constexpr auto view() const noexcept -> std::string_view { return m_message; }
+
+      constexpr auto operator==(const err_literal& rhs) const noexcept -> bool
+      {
+         return view() == rhs.view();
+      }
+
+   private:
+      std::string_view m_message;
+   };
+
+   /**
+    * @brief Construct an error holding a string literal, without allocating.
+    */
+   template <std::size_t Size>
+   consteval auto static_err(const char (&message)[Size]) -> err<err_literal> // NOLINT
+   {
+      return err<err_literal>(err_literal(message));
+   }
+
+   namespace detail
+   {
+      /**
+       * @brief The messages interned by 'interned_msg', indexed by 32 bit ids. Id 0 is the empty
+       * message.
+       *
+       * Interning a message already in the table only takes a shared lock & never allocates.
+       * Messages are stored once & never released, and their views are kept in chunks of doubling
+       * size that are never moved, so reading a message from its id takes no lock. The number of
+       * messages is published once a message is stored, so ids past it are never read.
+       */
+      class message_table
+      {
+         static constexpr std::size_t first_chunk_bits = 6;
+         static constexpr std::size_t chunk_count = 33 - first_chunk_bits;
+
+      public:
+         auto intern(std::string_view message) -> std::uint32_t
+         {
+            if (message.empty())
+            {
+               return 0;
+            }
+
+            {
+               const std::shared_lock lock(m_mutex);
+               if (const auto it = m_ids.find(message); it != std::end(m_ids))
+               {
+                  return it->second;
+               }
+            }
+
+            const std::unique_lock lock(m_mutex);
+            if (const auto it = m_ids.find(message); it != std::end(m_ids))
+            {
+               return it->second;
+            }
+
+            const std::string_view stored = m_messages.emplace_back(message);
+            const auto id = static_cast<std::uint32_t>(std::size(m_messages));
+            const auto [chunk, offset] = locate(id);
+
+            if (not m_owned_chunks[chunk])
+            {
+               m_owned_chunks[chunk] =
+                  std::make_unique<std::string_view[]>(chunk_size(chunk)); // NOLINT
+               m_chunks[chunk].store(m_owned_chunks[chunk].get(), std::memory_order_release);
+            }
+
+            m_owned_chunks[chunk][offset] = stored;
+            m_ids.emplace(stored, id);
+            m_count.store(id, std::memory_order_release);
+
+            return id;
+         }
+
+         /**
+          * @brief Get the message interned with 'id', or the empty message if no message was
+          * interned with it in this process.
+          */
+         [[nodiscard]] auto view(std::uint32_t id) const noexcept -> std::string_view
+         {
+            if (id == 0 or id > m_count.load(std::memory_order_acquire))
+            {
+               return {};
+            }
+
+            const auto [chunk, offset] = locate(id);
+
+            return m_chunks[chunk].load(std::memory_order_acquire)[offset]; // NOLINT
+         }
+
+      private:
+         static constexpr auto chunk_size(std::size_t chunk) noexcept -> std::size_t
+         {
+            return std::size_t{1} << (chunk + first_chunk_bits);
+         }
+         static constexpr auto locate(std::uint32_t id) noexcept
+            -> std::pair<std::size_t, std::size_t>
+         {
+            const std::uint64_t index = std::uint64_t{id} + (std::uint64_t{1} << first_chunk_bits);
+            const auto bits = static_cast<std::size_t>(std::bit_width(index) - 1);
+
+            return {bits - first_chunk_bits,
+                    static_cast<std::size_t>(index - (std::uint64_t{1} << bits))};
+         }
+
+      private:
+         std::shared_mutex m_mutex;
+         std::unordered_map<std::string_view, std::uint32_t> m_ids;
+         std::deque<std::string> m_messages;
+
+         std::array<std::unique_ptr<std::string_view[]>, chunk_count> m_owned_chunks{}; // NOLINT
+         std::array<std::atomic<const std::string_view*>, chunk_count> m_chunks{};
+         std::atomic<std::uint32_t> m_count = 0;
+      };
+
+      inline auto messages() -> message_table&
+      {
+         static message_table table;
+         return table;
+      }
+   } // namespace detail
+
+   /**
+    * @brief An error message interned in a process wide table & referred to by a 32 bit id, so a
+    * 'result<int, interned_msg>' fits in 8 bytes. Equal messages share the same id, making
+    * comparisons a single integer comparison.
+    *
+    * Interning a message for the first time copies it into the table. Later internings of the
+    * same message find it without allocating, which keeps the failure paths building the same
+    * messages over & over allocation free.
+    *
+    * Ids are only meaningful in the process that interned them, so it is not serializable. An id
+    * unknown to the table has the empty message.
+    */
+   class interned_msg
+   {
+   public:
+      using process_local = void;
+
+   public:
+      /**
+       * @brief Construct the empty message.
+       */
+      constexpr interned_msg() noexcept = default;
+      explicit interned_msg(std::string_view message) : m_id(detail::messages().intern(message))
+      {}
+
+      [[nodiscard]] constexpr auto id() const noexcept -> std::uint32_t { return m_id; }
+      [[nodiscard]] auto view() const noexcept -> std::string_view
+      {
+         return detail::messages().view(m_id);
+      }
+
+      constexpr auto operator==(const interned_msg&) const noexcept -> bool = default;
+
+   private:
+      std::uint32_t m_id = 0;
+   };
+
+   /**
+    * @brief Intern 'message' in the process wide table.
+    */
+   inline auto intern(std::string_view message) -> interned_msg
+   {
+      return interned_msg(message);
+   }
+} // namespace reglisse::v0
+
+namespace std // NOLINT
+{
+   template <>
+   struct hash<reglisse::err_literal>
+   {
+      auto operator()(const reglisse::err_literal& message) const noexcept -> std::size_t
+      {
+         return std::hash<std::string_view>()(message.view());
+      }
+   };
+
+   template <>
+   struct hash<reglisse::interned_msg>
+   {
+      auto operator()(const reglisse::interned_msg& message) const noexcept -> std::size_t
+      {
+         return std::hash<std::uint32_t>()(message.id());
+      }
+   };
+} // namespace std
+
+#endif // LIBREGLISSE_ERROR_MESSAGE_HPP
@@ -0,0 +1,255 @@
+/**
+ * @file format.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Contains the std::formatter specializations of the monads & their helpers
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_FORMAT_HPP
+#define LIBREGLISSE_FORMAT_HPP
+
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <version>
+
+#if defined(__cpp_lib_format)
+
+#   include <concepts>
+#   include <format>
+#   include <string_view>
+
+namespace reglisse::inline v0::detail
+{
+   template <typename T, typename CharT>
+   concept formattable_payload = std::semiregular<std::formatter<T, CharT>>;
+
+   template <typename CharT, typename OutputIt>
+   constexpr auto write_name(std::string_view name, OutputIt out) -> OutputIt
+   {
+      for (const char c : name)
+      {
+         *out++ = static_cast<CharT>(c);
+      }
+
+      return out;
+   }
+
+   /**
+    * @brief Formats a payload with the format spec given to the type holding it, written straight
+    * to the output between the name of its alternative & a closing parenthesis.
+    */
+   template <typename T, typename CharT>
+   class payload_formatter
+   {
+   public:
+      constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+      {
+         return m_formatter.parse(ctx);
+      }
+      /**
+       * @brief Parse the same format spec as an other alternative, which has already consumed it
+       * from the context. 'spec' holds the spec alone, without the closing brace or the rest of
+       * the format string. Specs holding nested replacement fields may only be given to types
+       * with a single alternative.
+       */
+      constexpr void parse_copy(std::basic_string_view<CharT> spec)
+      {
+         std::basic_format_parse_context<CharT> ctx(spec);
+         m_formatter.parse(ctx);
+      }
+
+      template <typename FormatContext>
+      auto format_as(std::string_view name, const T& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         ctx.advance_to(write_name<CharT>(name, ctx.out()));
+         ctx.advance_to(m_formatter.format(value, ctx));
+
+         return write_name<CharT>(")", ctx.out());
+      }
+
+   private:
+      std::formatter<T, CharT> m_formatter;
+   };
+
+   /**
+    * @brief Formats the alternatives of a type holding one of two payloads, giving the format
+    * spec to both.
+    */
+   template <typename First, typename Second, typename CharT>
+   class alternatives_formatter
+   {
+   public:
+      constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+      {
+         const auto first = ctx.begin();
+         const auto last = m_first.parse(ctx);
+
+         m_second.parse_copy(std::basic_string_view<CharT>(first, last));
+
+         return last;
+      }
+
+   protected:
+      payload_formatter<First, CharT> m_first;
+      payload_formatter<Second, CharT> m_second;
+   };
+} // namespace reglisse::v0::detail
+
+namespace std // NOLINT
+{
+   template <typename CharT>
+   struct formatter<reglisse::none_t, CharT>
+   {
+      constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+      {
+         auto it = ctx.begin();
+         while (it != ctx.end() and *it != CharT('}'))
+         {
+            ++it;
+         }
+
+         return it;
+      }
+
+      template <typename FormatContext>
+      auto format(reglisse::none_t, FormatContext& ctx) const -> typename FormatContext::iterator
+      {
+         return reglisse::detail::write_name<CharT>("none", ctx.out());
+      }
+   };
+
+   template <typename T, typename CharT>
+      requires reglisse::detail::formattable_payload<T, CharT>
+   struct formatter<reglisse::some<T>, CharT> : reglisse::detail::payload_formatter<T, CharT>
+   {
+      template <typename FormatContext>
+      auto format(const reglisse::some<T>& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         return this->format_as("some(", value.borrow(), ctx);
+      }
+   };
+
+   /**
+    * @brief Formats a maybe as 'some(value)' or 'none'. The format spec is given to the value, so
+    * "{:>10.3f}" pads a 'maybe<double>' to 'some(     3.142)'.
+    */
+   template <typename T, typename CharT>
+      requires reglisse::detail::formattable_payload<T, CharT>
+   struct formatter<reglisse::maybe<T>, CharT> : reglisse::detail::payload_formatter<T, CharT>
+   {
+      template <typename FormatContext>
+      auto format(const reglisse::maybe<T>& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         if (value.is_none())
+         {
+            return reglisse::detail::write_name<CharT>("none", ctx.out());
+         }
+
+         return this->format_as("some(", value.borrow(), ctx);
+      }
+   };
+
+   template <typename T, typename CharT>
+      requires reglisse::detail::formattable_payload<T, CharT>
+   struct formatter<reglisse::ok<T>, CharT> : reglisse::detail::payload_formatter<T, CharT>
+   {
+      template <typename FormatContext>
+      auto format(const reglisse::ok<T>& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         return this->format_as("ok(", value.value(), ctx);
+      }
+   };
+
+   template <typename T, typename CharT>
+      requires reglisse::detail::formattable_payload<T, CharT>
+   struct formatter<reglisse::err<T>, CharT> : reglisse::detail::payload_formatter<T, CharT>
+   {
+      template <typename FormatContext>
+      auto format(const reglisse::err<T>& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         return this->format_as("err(", value.value(), ctx);
+      }
+   };
+
+   /**
+    * @brief Formats a result as 'ok(value)' or 'err(error)'. The format spec is given to both the
+    * value & the error, which must both accept it.
+    */
+   template <typename T, typename E, typename CharT>
+      requires reglisse::detail::formattable_payload<T, CharT> and
+         reglisse::detail::formattable_payload<E, CharT>
+   struct formatter<reglisse::result<T, E>, CharT> :
+      reglisse::detail::alternatives_formatter<T, E, CharT>
+   {
+      template <typename FormatContext>
+      auto format(const reglisse::result<T, E>& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         if (value.is_ok())
+         {
+            return this->m_first.format_as("ok(", value.borrow(), ctx);
+         }
+
+         return this->m_second.format_as("err(", value.borrow_err(), ctx);
+      }
+   };
+
+   template <typename T, typename CharT>
+      requires reglisse::detail::formattable_payload<T, CharT>
+   struct formatter<reglisse::left<T>, CharT> : reglisse::detail::payload_formatter<T, CharT>
+   {
+      template <typename FormatContext>
+      auto format(const reglisse::left<T>& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         return this->format_as("left(", value.borrow(), ctx);
+      }
+   };
+
+   template <typename T, typename CharT>
+      requires reglisse::detail::formattable_payload<T, CharT>
+   struct formatter<reglisse::right<T>, CharT> : reglisse::detail::payload_formatter<T, CharT>
+   {
+      template <typename FormatContext>
+      auto format(const reglisse::right<T>& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         return this->format_as("right(", value.borrow(), ctx);
+      }
+   };
+
+   /**
+    * @brief Formats an either as 'left(value)' or 'right(value)'. The format spec is given to both
+    * sides, which must both accept it.
+    */
+   template <typename L, typename R, typename CharT>
+      requires reglisse::detail::formattable_payload<L, CharT> and
+         reglisse::detail::formattable_payload<R, CharT>
+   struct formatter<reglisse::either<L, R>, CharT> :
+      reglisse::detail::alternatives_formatter<L, R, CharT>
+   {
+      template <typename FormatContext>
+      auto format(const reglisse::either<L, R>& value, FormatContext& ctx) const
+         -> typename FormatContext::iterator
+      {
+         if (value.is_left())
+         {
+            return this->m_first.format_as("left(", value.borrow_left(), ctx);
+         }
+
+         return this->m_second.format_as("right(", value.borrow_right(), ctx);
+      }
+   };
+} // namespace std
+
+#endif // defined(__cpp_lib_format)
+
+#endif // LIBREGLISSE_FORMAT_HPP
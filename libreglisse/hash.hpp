@@ -0,0 +1,306 @@
+/**
+ * @file hash.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Contains the std::hash specializations of the monads & the transparent hasher used for
+ * heterogeneous lookup
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_HASH_HPP
+#define LIBREGLISSE_HASH_HPP
+
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      enum struct monad_family
+      {
+         maybe,
+         result,
+         either
+      };
+
+      /**
+       * @brief Describes the alternatives of a monad or of the helper naming one of them. 'visit'
+       * calls the visitor with the index of the held alternative & its payload, or 'none'.
+       */
+      template <typename T>
+      struct monad_alternatives;
+
+      template <typename T>
+      struct monad_alternatives<maybe<T>>
+      {
+         static constexpr monad_family family = monad_family::maybe;
+
+         template <typename Visitor>
+         static constexpr auto visit(const maybe<T>& value, Visitor&& visitor)
+         {
+            if (value.is_none())
+            {
+               return visitor(std::size_t{0}, none);
+            }
+
+            return visitor(std::size_t{1}, value.borrow());
+         }
+      };
+
+      template <>
+      struct monad_alternatives<none_t>
+      {
+         static constexpr monad_family family = monad_family::maybe;
+
+         template <typename Visitor>
+         static constexpr auto visit(none_t value, Visitor&& visitor)
+         {
+            return visitor(std::size_t{0}, value);
+         }
+      };
+
+      template <typename T>
+      struct monad_alternatives<some<T>>
+      {
+         static constexpr monad_family family = monad_family::maybe;
+
+         template <typename Visitor>
+         static constexpr auto visit(const some<T>& value, Visitor&& visitor)
+         {
+            return visitor(std::size_t{1}, value.borrow());
+         }
+      };
+
+      template <typename T, typename E>
+      struct monad_alternatives<result<T, E>>
+      {
+         static constexpr monad_family family = monad_family::result;
+
+         template <typename Visitor>
+         static constexpr auto visit(const result<T, E>& value, Visitor&& visitor)
+         {
+            if (value.is_err())
+            {
+               return visitor(std::size_t{0}, value.borrow_err());
+            }
+
+            return visitor(std::size_t{1}, value.borrow());
+         }
+      };
+
+      template <typename T>
+      struct monad_alternatives<err<T>>
+      {
+         static constexpr monad_family family = monad_family::result;
+
+         template <typename Visitor>
+         static constexpr auto visit(const err<T>& value, Visitor&& visitor)
+         {
+            return visitor(std::size_t{0}, value.value());
+         }
+      };
+
+      template <typename T>
+      struct monad_alternatives<ok<T>>
+      {
+         static constexpr monad_family family = monad_family::result;
+
+         template <typename Visitor>
+         static constexpr auto visit(const ok<T>& value, Visitor&& visitor)
+         {
+            return visitor(std::size_t{1}, value.value());
+         }
+      };
+
+      template <typename L, typename R>
+      struct monad_alternatives<either<L, R>>
+      {
+         static constexpr monad_family family = monad_family::either;
+
+         template <typename Visitor>
+         static constexpr auto visit(const either<L, R>& value, Visitor&& visitor)
+         {
+            if (value.is_left())
+            {
+               return visitor(std::size_t{0}, value.borrow_left());
+            }
+
+            return visitor(std::size_t{1}, value.borrow_right());
+         }
+      };
+
+      template <typename T>
+      struct monad_alternatives<left<T>>
+      {
+         static constexpr monad_family family = monad_family::either;
+
+         template <typename Visitor>
+         static constexpr auto visit(const left<T>& value, Visitor&& visitor)
+         {
+            return visitor(std::size_t{0}, value.borrow());
+         }
+      };
+
+      template <typename T>
+      struct monad_alternatives<right<T>>
+      {
+         static constexpr monad_family family = monad_family::either;
+
+         template <typename Visitor>
+         static constexpr auto visit(const right<T>& value, Visitor&& visitor)
+         {
+            return visitor(std::size_t{1}, value.borrow());
+         }
+      };
+
+      // clang-format off
+
+      template <typename T>
+      concept has_alternatives = requires
+      {
+         monad_alternatives<std::remove_cvref_t<T>>::family;
+      };
+
+      template <typename T>
+      concept hashable = requires(const T& value)
+      {
+         { std::hash<T>()(value) } -> std::convertible_to<std::size_t>;
+      };
+
+      template <typename First, typename Second>
+      concept weakly_equality_comparable = requires(const First& first, const Second& second)
+      {
+         { first == second } -> std::convertible_to<bool>;
+      };
+
+      // clang-format on
+
+      /**
+       * @brief Mix the index of an alternative with the hash of its payload, so that alternatives
+       * holding equal payloads hash differently.
+       */
+      constexpr auto mix_alternative(std::size_t index, std::size_t payload_hash) noexcept
+         -> std::size_t
+      {
+         auto res = static_cast<std::uint64_t>(payload_hash) +
+            0x9e3779b97f4a7c15 * (static_cast<std::uint64_t>(index) + 1); // NOLINT
+         res = (res ^ (res >> 30U)) * 0xbf58476d1ce4e5b9;                   // NOLINT
+         res = (res ^ (res >> 27U)) * 0x94d049bb133111eb;                   // NOLINT
+
+         return static_cast<std::size_t>(res ^ (res >> 31U)); // NOLINT
+      }
+
+      struct alternative_hash_fn
+      {
+         template <typename Payload>
+         auto operator()(std::size_t index, const Payload& payload) const -> std::size_t
+         {
+            if constexpr (std::same_as<Payload, none_t>)
+            {
+               return mix_alternative(index, 0);
+            }
+            else
+            {
+               return mix_alternative(index, std::hash<Payload>()(payload));
+            }
+         }
+      };
+   } // namespace detail
+
+   /**
+    * @brief A transparent hasher of the monads & of the helpers naming their alternatives. A
+    * helper hashes like the monad holding the same alternative, and payloads are hashed by their
+    * own 'std::hash', so an 'unordered_map' keyed on 'maybe<std::string>' may be searched for
+    * 'some(std::string_view(...))' without building a string. Used with 'monad_equal'.
+    */
+   struct monad_hash
+   {
+      using is_transparent = void;
+
+      template <detail::has_alternatives T>
+      auto operator()(const T& value) const -> std::size_t
+      {
+         return detail::monad_alternatives<T>::visit(value, detail::alternative_hash_fn());
+      }
+   };
+
+   /**
+    * @brief A transparent equality of the monads & of the helpers naming their alternatives. Two
+    * of them are equal when they hold the same alternative of the same kind of monad, with
+    * payloads comparing equal.
+    */
+   struct monad_equal
+   {
+      using is_transparent = void;
+
+      template <detail::has_alternatives First, detail::has_alternatives Second>
+      constexpr auto operator()(const First& first, const Second& second) const -> bool
+      {
+         using first_alternatives = detail::monad_alternatives<First>;
+         using second_alternatives = detail::monad_alternatives<Second>;
+
+         if constexpr (first_alternatives::family != second_alternatives::family)
+         {
+            return false;
+         }
+         else
+         {
+            return first_alternatives::visit(first, [&](std::size_t i, const auto& lhs) {
+               return second_alternatives::visit(second, [&](std::size_t j, const auto& rhs) {
+                  if constexpr (detail::weakly_equality_comparable<decltype(lhs), decltype(rhs)>)
+                  {
+                     return i == j and lhs == rhs;
+                  }
+                  else
+                  {
+                     return false;
+                  }
+               });
+            });
+         }
+      }
+   };
+} // namespace reglisse::v0
+
+namespace std // NOLINT
+{
+   template <typename T>
+      requires reglisse::detail::hashable<T>
+   struct hash<reglisse::maybe<T>>
+   {
+      auto operator()(const reglisse::maybe<T>& value) const -> std::size_t
+      {
+         return reglisse::monad_hash()(value);
+      }
+   };
+
+   template <typename T, typename E>
+      requires reglisse::detail::hashable<T> and reglisse::detail::hashable<E>
+   struct hash<reglisse::result<T, E>>
+   {
+      auto operator()(const reglisse::result<T, E>& value) const -> std::size_t
+      {
+         return reglisse::monad_hash()(value);
+      }
+   };
+
+   template <typename L, typename R>
+      requires reglisse::detail::hashable<L> and reglisse::detail::hashable<R>
+   struct hash<reglisse::either<L, R>>
+   {
+      auto operator()(const reglisse::either<L, R>& value) const -> std::size_t
+      {
+         return reglisse::monad_hash()(value);
+      }
+   };
+} // namespace std
+
+#endif // LIBREGLISSE_HASH_HPP
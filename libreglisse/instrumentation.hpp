@@ -0,0 +1,460 @@
+/**
+ * @file instrumentation.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Contains the opt-in counters recording how often each call site takes the error path
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_INSTRUMENTATION_HPP
+#define LIBREGLISSE_INSTRUMENTATION_HPP
+
+#include <libreglisse/concepts.hpp>
+#include <libreglisse/operations/pipe_closure.hpp>
+
+#if defined(LIBREGLISSE_USE_TRACING)
+#   include <libreglisse/tracing.hpp>
+#endif // defined(LIBREGLISSE_USE_TRACING)
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <ostream>
+#include <source_location>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reglisse::inline v0
+{
+   /**
+    * @brief The kind of call site recorded by the instrumentation.
+    */
+   enum struct call_site_kind : std::uint8_t
+   {
+      and_then,
+      or_else,
+      err,
+      none
+   };
+
+   /**
+    * @brief The counters of a single call site, summed over every thread.
+    *
+    * For the 'and_then' & 'or_else' stages, 'errors' counts the calls that returned an error or
+    * none, and 'error_time' sums the duration of the calls that received or returned one. For the
+    * 'err' & 'none' construction sites, only 'calls' is counted.
+    */
+   struct call_site_stats
+   {
+      std::string_view file_name;
+      std::string_view function_name;
+      std::uint32_t line = 0;
+      std::uint32_t column = 0;
+      call_site_kind kind = call_site_kind::and_then;
+
+      std::uint64_t calls = 0;
+      std::uint64_t errors = 0;
+      std::chrono::nanoseconds error_time{0};
+   };
+
+   namespace detail
+   {
+      inline constexpr std::size_t call_site_table_size = 1024;
+
+      /**
+       * @brief A slot of a call site table. The location is written once by the owning thread
+       * before 'file_name' is published, and never changes afterwards.
+       */
+      struct call_site_slot
+      {
+         std::atomic<const char*> file_name = nullptr;
+         const char* function_name = nullptr;
+         std::uint32_t line = 0;
+         std::uint32_t column = 0;
+         call_site_kind kind = call_site_kind::and_then;
+
+         std::atomic<std::uint64_t> calls = 0;
+         std::atomic<std::uint64_t> errors = 0;
+         std::atomic<std::uint64_t> error_nanoseconds = 0;
+      };
+
+      /**
+       * @brief An open addressing table of call sites written by a single thread. Tables are
+       * never freed, so a snapshot may read them while their thread runs or after it exits.
+       */
+      struct call_site_table
+      {
+         std::array<call_site_slot, call_site_table_size> slots;
+         std::atomic<std::uint64_t> dropped = 0;
+         std::atomic<bool> owned = true;
+         call_site_table* next = nullptr;
+      };
+
+      inline std::atomic<call_site_table*> call_site_tables = nullptr; // NOLINT
+
+      /**
+       * @brief Reuse the table of a thread that exited, or allocate a new one and push it on the
+       * list of tables.
+       */
+      inline auto acquire_call_site_table() noexcept -> call_site_table*
+      {
+         for (call_site_table* table = call_site_tables.load(std::memory_order_acquire);
+              table != nullptr; table = table->next)
+         {
+            bool expected = false;
+            if (table->owned.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+               return table;
+            }
+         }
+
+         auto* table = new (std::nothrow) call_site_table(); // NOLINT
+         if (table == nullptr)
+         {
+            return nullptr;
+         }
+
+         table->next = call_site_tables.load(std::memory_order_relaxed);
+         while (not call_site_tables.compare_exchange_weak(table->next, table,
+                                                           std::memory_order_release,
+                                                           std::memory_order_relaxed))
+         {}
+
+         return table;
+      }
+
+      class call_site_table_handle
+      {
+      public:
+         call_site_table_handle() noexcept : m_table(acquire_call_site_table()) {}
+         call_site_table_handle(const call_site_table_handle&) = delete;
+         call_site_table_handle(call_site_table_handle&&) = delete;
+         ~call_site_table_handle()
+         {
+            if (m_table)
+            {
+               m_table->owned.store(false, std::memory_order_release);
+            }
+         }
+
+         auto operator=(const call_site_table_handle&) -> call_site_table_handle& = delete;
+         auto operator=(call_site_table_handle&&) -> call_site_table_handle& = delete;
+
+         [[nodiscard]] auto get() const noexcept -> call_site_table* { return m_table; }
+
+      private:
+         call_site_table* m_table;
+      };
+
+      inline auto local_call_site_table() noexcept -> call_site_table*
+      {
+         thread_local call_site_table_handle handle;
+
+         return handle.get();
+      }
+
+      /**
+       * @brief Find the slot of a call site in the table of the calling thread, claiming a free
+       * one if the site was never seen. Returns null if the table is full.
+       */
+      inline auto find_call_site(call_site_table& table, call_site_kind kind,
+                                 const std::source_location& location) noexcept -> call_site_slot*
+      {
+         const char* file_name = location.file_name();
+
+         auto hash = static_cast<std::uint64_t>(std::bit_cast<std::uintptr_t>(file_name));
+         hash ^= (static_cast<std::uint64_t>(location.line()) << 16U) ^ location.column();
+         hash ^= static_cast<std::uint64_t>(kind) << 48U;
+         hash *= 0x9e3779b97f4a7c15ULL; // NOLINT
+         hash ^= hash >> 32U;
+
+         for (std::size_t i = 0; i < call_site_table_size; ++i)
+         {
+            call_site_slot& slot = table.slots[(hash + i) & (call_site_table_size - 1)];
+            const char* slot_file = slot.file_name.load(std::memory_order_relaxed);
+
+            if (slot_file == nullptr)
+            {
+               slot.function_name = location.function_name();
+               slot.line = location.line();
+               slot.column = location.column();
+               slot.kind = kind;
+               slot.file_name.store(file_name, std::memory_order_release);
+
+               return &slot;
+            }
+
+            if (slot_file == file_name and slot.line == location.line() and
+                slot.column == location.column() and slot.kind == kind)
+            {
+               return &slot;
+            }
+         }
+
+         return nullptr;
+      }
+
+      inline void record_call_site(call_site_kind kind, const std::source_location& location,
+                                   bool error, std::chrono::nanoseconds error_time) noexcept
+      {
+         call_site_table* table = local_call_site_table();
+         if (table == nullptr)
+         {
+            return;
+         }
+
+         call_site_slot* slot = find_call_site(*table, kind, location);
+         if (slot == nullptr)
+         {
+            table->dropped.fetch_add(1, std::memory_order_relaxed);
+
+            return;
+         }
+
+         slot->calls.fetch_add(1, std::memory_order_relaxed);
+
+         if (error)
+         {
+            slot->errors.fetch_add(1, std::memory_order_relaxed);
+         }
+
+         if (error_time.count() > 0)
+         {
+            slot->error_nanoseconds.fetch_add(static_cast<std::uint64_t>(error_time.count()),
+                                              std::memory_order_relaxed);
+         }
+      }
+
+      /**
+       * @brief Record the construction of an error or of an empty maybe.
+       */
+      inline void record_construction(call_site_kind kind,
+                                      const std::source_location& location) noexcept
+      {
+         record_call_site(kind, location, false, std::chrono::nanoseconds(0));
+      }
+
+      template <typename Monad>
+      constexpr auto holds_error(const Monad& m) noexcept -> bool
+      {
+         if constexpr (result_monad<const Monad&>)
+         {
+            return m.is_err();
+         }
+         else if constexpr (maybe_monad<const Monad&>)
+         {
+            return m.is_none();
+         }
+         else
+         {
+            return false;
+         }
+      }
+
+      /**
+       * @brief Call an operation on a monad, timing the call & recording it for 'location'. The
+       * call is also traced as a stage when 'LIBREGLISSE_USE_TRACING' is defined.
+       */
+      template <call_site_kind Kind, typename OpFunctor, typename Monad, typename Func>
+      constexpr auto record_stage(const std::source_location& location, Monad&& m, Func&& func)
+         -> decltype(auto)
+      {
+         if (std::is_constant_evaluated())
+         {
+            return OpFunctor()(std::forward<Monad>(m), std::forward<Func>(func));
+         }
+
+#if defined(LIBREGLISSE_USE_TRACING)
+         const trace_scope scope(operation_name_storage<OpFunctor>.data(), callable_name(func));
+#endif // defined(LIBREGLISSE_USE_TRACING)
+
+         const bool error_input = holds_error(m);
+         const auto start = std::chrono::steady_clock::now();
+
+         decltype(auto) res = OpFunctor()(std::forward<Monad>(m), std::forward<Func>(func));
+
+         const auto elapsed = std::chrono::steady_clock::now() - start;
+         const bool error_output = holds_error(res);
+
+         record_call_site(Kind, location, error_output,
+                          error_input or error_output
+                             ? std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                             : std::chrono::nanoseconds(0));
+
+         return res;
+      }
+   } // namespace detail
+
+   /**
+    * @brief An operation recording every call against the location it was written at.
+    *
+    * Used in place of 'operation' for the stages counted by the instrumentation when
+    * 'LIBREGLISSE_USE_INSTRUMENTATION' is defined. Both the direct call & the piped closure
+    * forms record the location of the call to the operation.
+    */
+   template <typename OpFunctor, call_site_kind Kind>
+   struct instrumented_operation
+   {
+      template <typename Monad, typename Func>
+         requires detail::operation_invocable<OpFunctor, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func,
+                                std::source_location location = std::source_location::current())
+         const -> decltype(auto)
+      {
+         return detail::record_stage<Kind, OpFunctor>(
+            location, detail::adopt(std::forward<Monad>(m)), std::forward<Func>(func));
+      }
+
+      template <typename Func>
+         requires(not std::invocable<OpFunctor, Func>)
+      constexpr auto operator()(Func func,
+                                std::source_location location = std::source_location::current())
+         const
+      {
+         return make_pipe_closure(
+            [func = std::move(func), location]<typename T>(T&& m)
+               -> decltype(OpFunctor()(detail::adopt(std::forward<T>(m)), Func(func))) {
+               return detail::record_stage<Kind, OpFunctor>(
+                  location, detail::adopt(std::forward<T>(m)), Func(func));
+            });
+      }
+   };
+
+   /**
+    * @brief Sum the counters of every thread, merging the call sites seen by several translation
+    * units. The sites are sorted by decreasing error count.
+    *
+    * The counters are read while other threads may update them, so the snapshot may be slightly
+    * out of date.
+    */
+   inline auto call_site_snapshot() -> std::vector<call_site_stats>
+   {
+      std::vector<call_site_stats> res;
+
+      for (detail::call_site_table* table =
+              detail::call_site_tables.load(std::memory_order_acquire);
+           table != nullptr; table = table->next)
+      {
+         for (const detail::call_site_slot& slot : table->slots)
+         {
+            const char* file_name = slot.file_name.load(std::memory_order_acquire);
+            if (file_name == nullptr)
+            {
+               continue;
+            }
+
+            const auto calls = slot.calls.load(std::memory_order_relaxed);
+            const auto errors = slot.errors.load(std::memory_order_relaxed);
+            const auto error_time = std::chrono::nanoseconds(
+               static_cast<std::int64_t>(slot.error_nanoseconds.load(std::memory_order_relaxed)));
+
+            const auto it = std::ranges::find_if(res, [&](const call_site_stats& stats) {
+               return stats.line == slot.line and stats.column == slot.column and
+                  stats.kind == slot.kind and stats.file_name == std::string_view(file_name);
+            });
+
+            if (it != std::end(res))
+            {
+               it->calls += calls;
+               it->errors += errors;
+               it->error_time += error_time;
+            }
+            else
+            {
+               res.push_back({.file_name = file_name,
+                              .function_name = slot.function_name,
+                              .line = slot.line,
+                              .column = slot.column,
+                              .kind = slot.kind,
+                              .calls = calls,
+                              .errors = errors,
+                              .error_time = error_time});
+            }
+         }
+      }
+
+      std::ranges::stable_sort(res, std::ranges::greater{}, &call_site_stats::errors);
+
+      return res;
+   }
+
+   /**
+    * @brief Get the number of records dropped because the table of their thread was full.
+    */
+   inline auto dropped_call_site_count() noexcept -> std::uint64_t
+   {
+      std::uint64_t res = 0;
+
+      for (detail::call_site_table* table =
+              detail::call_site_tables.load(std::memory_order_acquire);
+           table != nullptr; table = table->next)
+      {
+         res += table->dropped.load(std::memory_order_relaxed);
+      }
+
+      return res;
+   }
+
+   /**
+    * @brief Reset the counters of every call site. The sites themselves are kept.
+    */
+   inline void reset_call_sites() noexcept
+   {
+      for (detail::call_site_table* table =
+              detail::call_site_tables.load(std::memory_order_acquire);
+           table != nullptr; table = table->next)
+      {
+         for (detail::call_site_slot& slot : table->slots)
+         {
+            slot.calls.store(0, std::memory_order_relaxed);
+            slot.errors.store(0, std::memory_order_relaxed);
+            slot.error_nanoseconds.store(0, std::memory_order_relaxed);
+         }
+
+         table->dropped.store(0, std::memory_order_relaxed);
+      }
+   }
+
+   constexpr auto to_string_view(call_site_kind kind) noexcept -> std::string_view
+   {
+      switch (kind)
+      {
+         case call_site_kind::and_then:
+            return "and_then";
+         case call_site_kind::or_else:
+            return "or_else";
+         case call_site_kind::err:
+            return "err";
+         case call_site_kind::none:
+            return "none";
+      }
+
+      return "unknown";
+   }
+
+   /**
+    * @brief Write a snapshot of the call sites as CSV, one site per line, preceded by a header.
+    */
+   inline void export_call_sites(std::ostream& os)
+   {
+      os << "kind,file,line,column,function,calls,errors,error_ns\n";
+
+      for (const call_site_stats& stats : call_site_snapshot())
+      {
+         os << to_string_view(stats.kind) << ",\"" << stats.file_name << "\"," << stats.line << ','
+            << stats.column << ",\"" << stats.function_name << "\"," << stats.calls << ','
+            << stats.errors << ',' << stats.error_time.count() << '\n';
+      }
+   }
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_INSTRUMENTATION_HPP
@@ -0,0 +1,354 @@
+/**
+ * @file lazy.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the lazy wrapper deferring the computation of a monad
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_LAZY_HPP
+#define LIBREGLISSE_LAZY_HPP
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/or_else.hpp>
+#include <libreglisse/operations/transform.hpp>
+#include <libreglisse/operations/transform_at.hpp>
+#include <libreglisse/operations/transform_err.hpp>
+#include <libreglisse/operations/transform_join_left.hpp>
+#include <libreglisse/operations/transform_join_right.hpp>
+#include <libreglisse/operations/transform_left.hpp>
+#include <libreglisse/operations/transform_right.hpp>
+#include <libreglisse/tag_invoke.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   /**
+    * @brief Selects how a lazy value guards its evaluation.
+    */
+   enum struct lazy_policy
+   {
+      unsynchronized, ///< The value may only be accessed by one thread at a time.
+      synchronized    ///< The first access from any thread evaluates the value exactly once.
+   };
+
+   template <std::movable T, lazy_policy Policy = lazy_policy::unsynchronized>
+      requires(not std::is_reference_v<T>)
+   class lazy;
+
+   namespace detail
+   {
+      /**
+       * @brief Operations that are composed into the computation of a lazy value instead of
+       * evaluating it.
+       */
+      template <typename Op>
+      inline constexpr bool is_deferrable_operation_v = false;
+
+      template <>
+      inline constexpr bool is_deferrable_operation_v<transform_fn> = true;
+      template <>
+      inline constexpr bool is_deferrable_operation_v<transform_err_fn> = true;
+      template <>
+      inline constexpr bool is_deferrable_operation_v<and_then_fn> = true;
+      template <>
+      inline constexpr bool is_deferrable_operation_v<or_else_fn> = true;
+      template <>
+      inline constexpr bool is_deferrable_operation_v<transform_left_fn> = true;
+      template <>
+      inline constexpr bool is_deferrable_operation_v<transform_right_fn> = true;
+      template <>
+      inline constexpr bool is_deferrable_operation_v<transform_join_left_fn> = true;
+      template <>
+      inline constexpr bool is_deferrable_operation_v<transform_join_right_fn> = true;
+      template <std::size_t Index>
+      inline constexpr bool is_deferrable_operation_v<transform_at_fn<Index>> = true;
+
+      template <typename Op>
+      concept deferrable_operation = is_deferrable_operation_v<Op>;
+
+      enum struct lazy_state : std::uint8_t
+      {
+         pending,
+         running,
+         ready
+      };
+   } // namespace detail
+
+   /**
+    * @brief Holds a function computing a value, usually a monad, which is called the first time
+    * the value is accessed. The value is then kept for the later accesses.
+    *
+    * Deferrable operations such as 'transform' or 'and_then' may be piped onto an rvalue lazy
+    * value. They are composed into a new lazy value without evaluating anything, so a chain of
+    * operations only runs if its final value is ever accessed.
+    *
+    * With the 'synchronized' policy, concurrent first accesses are serialized through an atomic
+    * state: one thread evaluates the function while the others wait on the state. If the function
+    * throws, the exception propagates to the thread that called it and the next access retries.
+    * Moving a lazy value is never synchronized.
+    */
+   template <std::movable T, lazy_policy Policy>
+      requires(not std::is_reference_v<T>)
+   class lazy
+   {
+      static constexpr bool is_synchronized = Policy == lazy_policy::synchronized;
+
+      using state_type = std::conditional_t<is_synchronized, std::atomic<detail::lazy_state>,
+                                            detail::lazy_state>;
+
+   public:
+      using value_type = T; ///< Type of the value computed
+
+      static constexpr lazy_policy policy = Policy;
+
+   public:
+      lazy() = delete;
+      /**
+       * @brief Construct from the function computing the value.
+       *
+       * @param [in] func A copyable function taking no arguments.
+       */
+      template <typename Func>
+         requires(not std::same_as<std::remove_cvref_t<Func>, lazy>) and
+         std::invocable<Func&> and std::convertible_to<std::invoke_result_t<Func&>, value_type> and
+         std::copy_constructible<std::decay_t<Func>>
+      explicit lazy(Func&& func) : m_func(std::forward<Func>(func))
+      {}
+      lazy(const lazy&) = delete;
+      /**
+       * @brief Move construct a lazy value, moving the value if it was evaluated or the function
+       * otherwise.
+       */
+      lazy(lazy&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>) :
+         m_func(std::move(other.m_func)), m_state(other.load_state())
+      {
+         if (load_state() == detail::lazy_state::ready)
+         {
+            std::construct_at(&m_value, std::move(other.m_value)); // NOLINT
+         }
+      }
+      ~lazy() { reset(); }
+
+      auto operator=(const lazy&) -> lazy& = delete;
+      auto operator=(lazy&& rhs) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+         -> lazy&
+      {
+         if (this != &rhs)
+         {
+            reset();
+
+            m_func = std::move(rhs.m_func);
+            if (rhs.load_state() == detail::lazy_state::ready)
+            {
+               std::construct_at(&m_value, std::move(rhs.m_value)); // NOLINT
+            }
+            store_state(rhs.load_state());
+         }
+
+         return *this;
+      }
+
+      /**
+       * @brief Borrow the value, computing it if this is the first access.
+       *
+       * @returns The computed value.
+       */
+      auto borrow() const& -> const value_type&
+      {
+         evaluate();
+
+         return m_value; // NOLINT
+      }
+      /**
+       * @brief Borrow the value, computing it if this is the first access.
+       *
+       * @returns The computed value.
+       */
+      auto borrow() & -> value_type&
+      {
+         evaluate();
+
+         return m_value; // NOLINT
+      }
+      /**
+       * @brief Take the value, computing it if this is the first access. This operation leaves
+       * the lazy value in an undefined state.
+       *
+       * @returns The computed value.
+       */
+      auto take() && -> value_type
+      {
+         evaluate();
+
+         return std::move(m_value); // NOLINT
+      }
+
+      /**
+       * @brief Check if the value was already computed.
+       */
+      [[nodiscard]] auto is_evaluated() const noexcept -> bool
+      {
+         return load_state() == detail::lazy_state::ready;
+      }
+
+      /**
+       * @brief Compose a deferrable operation into a new lazy value without evaluating this one.
+       *
+       * The lazy value is moved into shared storage captured by the new function along with
+       * copies of the arguments of the operation. The operation borrows the value, which is left
+       * intact if it throws, so the next access retries it on the same value.
+       */
+      template <detail::deferrable_operation Op, typename... Args>
+         requires std::invocable<const Op&, const value_type&, const std::decay_t<Args>&...> and
+         std::movable<
+            std::invoke_result_t<const Op&, const value_type&, const std::decay_t<Args>&...>>
+      friend auto tag_invoke(Op op, lazy&& self, Args&&... args)
+         -> lazy<std::invoke_result_t<const Op&, const value_type&, const std::decay_t<Args>&...>,
+                 Policy>
+      {
+         using res_t =
+            std::invoke_result_t<const Op&, const value_type&, const std::decay_t<Args>&...>;
+
+         auto source = std::make_shared<lazy>(std::move(self));
+
+         return lazy<res_t, Policy>([op, source = std::move(source),
+                                     ... args = std::decay_t<Args>(std::forward<Args>(args))]() {
+            return std::invoke(op, std::as_const(*source).borrow(), args...);
+         });
+      }
+
+   private:
+      void evaluate() const
+      {
+         if constexpr (is_synchronized)
+         {
+            while (true)
+            {
+               auto state = m_state.load(std::memory_order_acquire);
+
+               if (state == detail::lazy_state::ready)
+               {
+                  return;
+               }
+
+               if (state == detail::lazy_state::pending)
+               {
+                  if (m_state.compare_exchange_weak(state, detail::lazy_state::running,
+                                                    std::memory_order_acquire))
+                  {
+                     compute();
+                     m_state.notify_all();
+
+                     return;
+                  }
+               }
+               else
+               {
+                  m_state.wait(state, std::memory_order_acquire);
+               }
+            }
+         }
+         else
+         {
+            if (m_state != detail::lazy_state::ready)
+            {
+               compute();
+            }
+         }
+      }
+
+      void compute() const
+      {
+#if defined(__cpp_exceptions)
+         try
+         {
+            std::construct_at(&m_value, std::invoke(m_func)); // NOLINT
+         }
+         catch (...)
+         {
+            store_state(detail::lazy_state::pending);
+
+            if constexpr (is_synchronized)
+            {
+               m_state.notify_all();
+            }
+
+            throw;
+         }
+#else
+         std::construct_at(&m_value, std::invoke(m_func)); // NOLINT
+#endif // defined(__cpp_exceptions)
+
+         m_func = nullptr;
+         store_state(detail::lazy_state::ready);
+      }
+
+      void reset() noexcept
+      {
+         if (load_state() == detail::lazy_state::ready)
+         {
+            std::destroy_at(&m_value); // NOLINT
+         }
+
+         store_state(detail::lazy_state::pending);
+      }
+
+      [[nodiscard]] auto load_state() const noexcept -> detail::lazy_state
+      {
+         if constexpr (is_synchronized)
+         {
+            return m_state.load(std::memory_order_acquire);
+         }
+         else
+         {
+            return m_state;
+         }
+      }
+      void store_state(detail::lazy_state state) const noexcept
+      {
+         if constexpr (is_synchronized)
+         {
+            m_state.store(state, std::memory_order_release);
+         }
+         else
+         {
+            m_state = state;
+         }
+      }
+
+   private:
+      mutable std::function<value_type()> m_func;
+      mutable state_type m_state = detail::lazy_state::pending;
+
+      union
+      {
+         mutable value_type m_value;
+      };
+   };
+
+   /**
+    * @brief A lazily computed maybe.
+    */
+   template <typename T, lazy_policy Policy = lazy_policy::unsynchronized>
+   using lazy_maybe = lazy<maybe<T>, Policy>;
+
+   /**
+    * @brief A lazily computed result.
+    */
+   template <typename T, typename E, lazy_policy Policy = lazy_policy::unsynchronized>
+   using lazy_result = lazy<result<T, E>, Policy>;
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_LAZY_HPP
@@ -15,12 +15,20 @@
 #   include <cassert>
 #endif // defined (LIBREGLISSE_USE_EXCEPTIONS)
 
+#if defined(LIBREGLISSE_USE_INSTRUMENTATION)
+#   include <libreglisse/instrumentation.hpp>
+#endif // defined(LIBREGLISSE_USE_INSTRUMENTATION)
+
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/ref.hpp>
+#include <libreglisse/relocate.hpp>
 
 #include <compare>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
+#include <span>
 #include <utility>
 
 namespace reglisse::inline v0
@@ -150,13 +158,52 @@ namespace reglisse::inline v0
       /**
        * @brief construct an empty monad.
        */
+#if defined(LIBREGLISSE_USE_INSTRUMENTATION)
+      constexpr maybe(none_t,
+                      std::source_location location = std::source_location::current()) noexcept
+      {
+         if (not std::is_constant_evaluated())
+         {
+            detail::record_construction(call_site_kind::none, location);
+         }
+      };
+#else
       constexpr maybe(none_t) noexcept {};
+#endif // defined(LIBREGLISSE_USE_INSTRUMENTATION)
       /**
        * @brief construct monad from some value.
        *
        * @param val The value to take.
        */
       constexpr maybe(some<T>&& val) : m_is_none(false), m_value(std::move(val).take()) {}
+      /**
+       * @brief Construct from a std::optional, copying its value if it holds one.
+       */
+      explicit constexpr maybe(const std::optional<value_type>& other) :
+         m_is_none(not other.has_value())
+      {
+         if (other.has_value())
+         {
+            std::construct_at(&m_value, *other); // NOLINT
+         }
+      }
+      /**
+       * @brief Construct from a std::optional, moving its value if it holds one.
+       */
+      explicit constexpr maybe(std::optional<value_type>&& other) :
+         m_is_none(not other.has_value())
+      {
+         if (other.has_value())
+         {
+            std::construct_at(&m_value, std::move(*other)); // NOLINT
+         }
+      }
+      /**
+       * @brief Trivially copy construct a maybe.
+       */
+      constexpr maybe(const maybe&)
+         requires detail::trivially_copy_constructible<value_type>
+      = default;
       /**
        * @brief Copy construct a maybe.
        */
@@ -167,6 +214,12 @@ namespace reglisse::inline v0
             std::construct_at(&m_value, other.m_value); // NOLINT
          }
       }
+      /**
+       * @brief Trivially move construct a maybe.
+       */
+      constexpr maybe(maybe&&) noexcept
+         requires detail::trivially_move_constructible<value_type>
+      = default;
       /**
        * @brief Move construct a maybe.
        */
@@ -177,6 +230,10 @@ namespace reglisse::inline v0
             std::construct_at(&m_value, std::move(other.m_value)); // NOLINT
          }
       }
+      /**
+       * @brief Trivially destroy a maybe.
+       */
+      constexpr ~maybe() requires detail::trivially_destructible<value_type> = default;
       /**
        * @brief Destroy maybe.
        */
@@ -188,41 +245,81 @@ namespace reglisse::inline v0
          }
       }
 
+      /**
+       * @brief Trivially copy assign a maybe.
+       */
+      constexpr auto operator=(const maybe&) -> maybe&
+         requires detail::trivially_copy_assignable<value_type>
+      = default;
+      /**
+       * @brief Copy assign a maybe.
+       *
+       * If both monads hold a value, the value is assigned in place to reuse its storage.
+       */
       constexpr auto operator=(const maybe& rhs) -> maybe&
       {
          if (this != &rhs)
          {
-            if (is_some())
+            if (is_some() && rhs.is_some())
             {
-               std::destroy_at(&m_value); // NOLINT
+               if constexpr (std::is_copy_assignable_v<value_type>)
+               {
+                  m_value = rhs.m_value; // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_value);                // NOLINT
+                  std::construct_at(&m_value, rhs.m_value); // NOLINT
+               }
             }
-
-            m_is_none = rhs.is_none();
-            rhs.m_is_none = false;
-
-            if (is_some())
+            else if (rhs.is_some())
             {
-               std::construct_at(&m_value, rhs.borrow()); // NOLINT
+               std::construct_at(&m_value, rhs.m_value); // NOLINT
+               m_is_none = false;
+            }
+            else
+            {
+               reset();
             }
          }
 
          return *this;
       }
+      /**
+       * @brief Trivially move assign a maybe.
+       */
+      constexpr auto operator=(maybe&&) noexcept -> maybe&
+         requires detail::trivially_move_assignable<value_type>
+      = default;
+      /**
+       * @brief Move assign a maybe.
+       *
+       * If both monads hold a value, the value is move assigned in place to reuse its storage.
+       */
       constexpr auto operator=(maybe&& rhs) noexcept -> maybe&
       {
          if (this != &rhs)
          {
-            if (is_some())
+            if (is_some() && rhs.is_some())
             {
-               std::destroy_at(&m_value); // NOLINT
+               if constexpr (std::is_move_assignable_v<value_type>)
+               {
+                  m_value = std::move(rhs.m_value); // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_value);                           // NOLINT
+                  std::construct_at(&m_value, std::move(rhs.m_value)); // NOLINT
+               }
             }
-
-            m_is_none = rhs.is_none();
-            rhs.m_is_none = false;
-
-            if (is_some())
+            else if (rhs.is_some())
             {
-               std::construct_at(&m_value, std::move(rhs).take()); // NOLINT
+               std::construct_at(&m_value, std::move(rhs.m_value)); // NOLINT
+               m_is_none = false;
+            }
+            else
+            {
+               reset();
             }
          }
 
@@ -339,6 +436,155 @@ namespace reglisse::inline v0
          return static_cast<value_type>(std::forward<U>(or_val));
       }
 
+      /**
+       * @brief Copy the monad into a std::optional.
+       */
+      [[nodiscard]] constexpr auto to_optional() const& -> std::optional<value_type>
+      {
+         if (is_none())
+         {
+            return std::nullopt;
+         }
+
+         return std::optional<value_type>(std::in_place, m_value); // NOLINT
+      }
+      /**
+       * @brief Move the monad into a std::optional, moving its value once.
+       */
+      [[nodiscard]] constexpr auto to_optional() && -> std::optional<value_type>
+      {
+         if (is_none())
+         {
+            return std::nullopt;
+         }
+
+         return std::optional<value_type>(std::in_place, std::move(m_value)); // NOLINT
+      }
+      /**
+       * @brief Borrow the value stored in the monad through a std::optional holding a reference
+       * to it, for interfaces taking optional references.
+       */
+      [[nodiscard]] constexpr auto borrow_optional() const& -> std::optional<const_ref<value_type>>
+      {
+         if (is_none())
+         {
+            return std::nullopt;
+         }
+
+         return std::cref(m_value); // NOLINT
+      }
+      /**
+       * @brief Borrow the value stored in the monad through a std::optional holding a mutable
+       * reference to it, for interfaces taking optional references.
+       */
+      [[nodiscard]] constexpr auto borrow_optional() & -> std::optional<mut_ref<value_type>>
+      {
+         if (is_none())
+         {
+            return std::nullopt;
+         }
+
+         return std::ref(m_value); // NOLINT
+      }
+
+      /**
+       * @brief Call 'on_some' with the value stored in the monad, or 'on_none' if it is empty.
+       *
+       * The discriminant is tested once and the value is handed over without the checks done by
+       * 'borrow' & 'take'. It is moved into 'on_some' if the monad is an rvalue.
+       *
+       * @param [in] on_some The function called with the value stored.
+       * @param [in] on_none The function called if the monad is empty.
+       *
+       * @returns The value returned by the function called, converted to the common type of both.
+       */
+      template <std::invocable<const value_type&> OnSome, std::invocable<> OnNone>
+      constexpr auto match(OnSome&& on_some, OnNone&& on_none) const&
+         -> std::common_type_t<std::invoke_result_t<OnSome, const value_type&>,
+                               std::invoke_result_t<OnNone>>
+      {
+         if (is_some())
+         {
+            return std::invoke(std::forward<OnSome>(on_some), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnNone>(on_none));
+      }
+      template <std::invocable<value_type&> OnSome, std::invocable<> OnNone>
+      constexpr auto match(OnSome&& on_some, OnNone&& on_none) &
+         -> std::common_type_t<std::invoke_result_t<OnSome, value_type&>,
+                               std::invoke_result_t<OnNone>>
+      {
+         if (is_some())
+         {
+            return std::invoke(std::forward<OnSome>(on_some), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnNone>(on_none));
+      }
+      template <std::invocable<const value_type&&> OnSome, std::invocable<> OnNone>
+      constexpr auto match(OnSome&& on_some, OnNone&& on_none) const&&
+         -> std::common_type_t<std::invoke_result_t<OnSome, const value_type&&>,
+                               std::invoke_result_t<OnNone>>
+      {
+         if (is_some())
+         {
+            return std::invoke(std::forward<OnSome>(on_some), std::move(m_value)); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnNone>(on_none));
+      }
+      template <std::invocable<value_type&&> OnSome, std::invocable<> OnNone>
+      constexpr auto match(OnSome&& on_some, OnNone&& on_none) &&
+         -> std::common_type_t<std::invoke_result_t<OnSome, value_type&&>,
+                               std::invoke_result_t<OnNone>>
+      {
+         if (is_some())
+         {
+            return std::invoke(std::forward<OnSome>(on_some), std::move(m_value)); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnNone>(on_none));
+      }
+
+      /**
+       * @brief Get a pointer to the value stored in the monad, the monad being a range of zero or
+       * one element.
+       */
+      constexpr auto begin() noexcept -> value_type* { return std::addressof(m_value); } // NOLINT
+      constexpr auto begin() const noexcept -> const value_type*
+      {
+         return std::addressof(m_value); // NOLINT
+      }
+      /**
+       * @brief Get a pointer past the value stored in the monad, equal to 'begin()' if the monad is
+       * empty.
+       */
+      constexpr auto end() noexcept -> value_type* { return begin() + size(); }
+      constexpr auto end() const noexcept -> const value_type* { return begin() + size(); }
+      /**
+       * @brief Get the number of values stored in the monad, zero or one.
+       */
+      [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+      {
+         return is_some() ? 1U : 0U;
+      }
+
+      /**
+       * @brief View the monad as a contiguous range of zero or one element.
+       *
+       * The span borrows the storage of the monad, so it must not outlive it. In particular, the
+       * span of a temporary monad dangles once the full expression ends.
+       */
+      constexpr auto view() noexcept -> std::span<value_type, std::dynamic_extent>
+      {
+         return {begin(), size()};
+      }
+      constexpr auto view() const noexcept -> std::span<const value_type, std::dynamic_extent>
+      {
+         return {begin(), size()};
+      }
+
       /**
        * @brief Reset the monad to it's default state
        */
@@ -469,6 +715,37 @@ namespace reglisse::inline v0
    {
       return m.is_some() ? m.borrow() <=> value : std::strong_ordering::less;
    }
+
+   /**
+    * @brief A maybe is trivially relocatable when its payloads are.
+    */
+   template <typename T>
+   struct is_trivially_relocatable<maybe<T>> :
+      std::bool_constant<is_trivially_relocatable_v<T>>
+   {};
+
+   namespace detail
+   {
+      /**
+       * @brief Operations apply to a std::optional as to the maybe it converts to.
+       *
+       * The operations take monads, so adopting an lvalue copies its value into a temporary maybe
+       * once per operation, while adopting an rvalue moves it. Pipe 'std::move(opt)' to avoid
+       * the copy.
+       */
+      template <typename T>
+      struct monad_adaptor<std::optional<T>>
+      {
+         static constexpr auto adopt(const std::optional<T>& value) -> maybe<T>
+         {
+            return maybe<T>(value);
+         }
+         static constexpr auto adopt(std::optional<T>&& value) -> maybe<T>
+         {
+            return maybe<T>(std::move(value));
+         }
+      };
+   } // namespace detail
 } // namespace reglisse::v0
 
 namespace std // NOLINT
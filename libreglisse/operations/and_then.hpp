@@ -10,10 +10,16 @@
 #define LIBREGLISSE_OPERATIONS_AND_THEN_HPP
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
 #include <libreglisse/maybe.hpp>
 #include <libreglisse/result.hpp>
 
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
+
+#if defined(LIBREGLISSE_USE_INSTRUMENTATION)
+#   include <libreglisse/instrumentation.hpp>
+#endif // defined(LIBREGLISSE_USE_INSTRUMENTATION)
 
 namespace reglisse::inline v0
 {
@@ -25,12 +31,24 @@ namespace reglisse::inline v0
 
    /**
     * @brief Functor used to implement the 'and_then' operation on maybe & result monads
+    *
+    * Types modeling 'maybe_monad' or 'result_monad' are supported and produce a libreglisse monad.
+    * The operation may be customized for a user defined type by providing a 'tag_invoke' overload.
     */
    struct and_then_fn
    {
+      template <typename Monad, typename Func>
+         requires tag_invocable<and_then_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<and_then_fn, Monad, Func>)
+            -> tag_invoke_result_t<and_then_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
       template <typename ValueType, std::invocable<ValueType> Func>
          requires detail::and_then_returns_maybe<ValueType, Func>
-      constexpr auto operator()(const maybe<ValueType>&& m, Func some_func) const
+      constexpr auto operator()(const maybe<ValueType>&& m, Func&& some_func) const
          -> std::invoke_result_t<Func, ValueType>
       {
          if (m.is_some())
@@ -42,7 +60,7 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, std::invocable<ValueType> Func>
          requires detail::and_then_returns_maybe<ValueType, Func>
-      constexpr auto operator()(maybe<ValueType>&& m, Func some_func) const
+      constexpr auto operator()(maybe<ValueType>&& m, Func&& some_func) const
          -> std::invoke_result_t<Func, ValueType>
       {
          if (m.is_some())
@@ -54,7 +72,7 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, std::invocable<ValueType> Func>
          requires detail::and_then_returns_maybe<ValueType, Func>
-      constexpr auto operator()(const maybe<ValueType>& m, Func some_func) const
+      constexpr auto operator()(const maybe<ValueType>& m, Func&& some_func) const
          -> std::invoke_result_t<Func, ValueType>
       {
          if (m.is_some())
@@ -66,7 +84,7 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, std::invocable<ValueType> Func>
          requires detail::and_then_returns_maybe<ValueType, Func>
-      constexpr auto operator()(maybe<ValueType>& m, Func some_func) const
+      constexpr auto operator()(maybe<ValueType>& m, Func&& some_func) const
          -> std::invoke_result_t<Func, ValueType>
       {
          if (m.is_some())
@@ -125,12 +143,47 @@ namespace reglisse::inline v0
 
          return res_t(err(r.borrow_err()));
       }
+
+      template <maybe_monad Monad, typename Func>
+         requires(not tag_invocable<and_then_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_value_t<Monad>> and
+         detail::and_then_returns_maybe<detail::forward_value_t<Monad>, Func>
+      constexpr auto operator()(Monad&& m, Func&& some_func) const
+         -> std::invoke_result_t<Func, detail::forward_value_t<Monad>>
+      {
+         if (m.is_some())
+         {
+            return std::invoke(std::forward<Func>(some_func),
+                               detail::forward_value(std::forward<Monad>(m)));
+         }
+
+         return none;
+      }
+      template <result_monad Monad, typename Func>
+         requires(not tag_invocable<and_then_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_value_t<Monad>>
+      constexpr auto operator()(Monad&& m, Func&& value_func) const
+      {
+         using res_t = std::invoke_result_t<Func, detail::forward_value_t<Monad>>;
+
+         if (m.is_ok())
+         {
+            return std::invoke(std::forward<Func>(value_func),
+                               detail::forward_value(std::forward<Monad>(m)));
+         }
+
+         return res_t(err(detail::forward_error(std::forward<Monad>(m))));
+      }
    };
 
    /**
     * @brief The 'and_then' operation used on maybe & result.
     */
+#if defined(LIBREGLISSE_USE_INSTRUMENTATION)
+   const constexpr instrumented_operation<and_then_fn, call_site_kind::and_then> and_then = {};
+#else
    const constexpr operation<and_then_fn> and_then = {};
+#endif // defined(LIBREGLISSE_USE_INSTRUMENTATION)
 } // namespace reglisse::v0
 
 #endif // LIBREGLISSE_OPERATIONS_AND_THEN_HPP
@@ -0,0 +1,154 @@
+/**
+ * @file operations/apply.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the 'apply' operation
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_OPERATIONS_APPLY_HPP
+#define LIBREGLISSE_OPERATIONS_APPLY_HPP
+
+#include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/operations/zip.hpp>
+#include <libreglisse/tag_invoke.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      template <typename Type>
+      concept any_monad = monad<std::remove_cvref_t<Type>>;
+
+      template <typename Func, typename Tuple, std::size_t... Indices>
+      constexpr auto is_applicable(std::index_sequence<Indices...> /* indices */) -> bool
+      {
+         return std::invocable<Func, decltype(std::get<Indices>(std::declval<Tuple>()))...>;
+      }
+
+      /**
+       * @brief Check if 'Func' may be called with the unpacked elements of 'Tuple'.
+       */
+      template <typename Func, typename Tuple>
+      concept applicable = requires { std::tuple_size<std::remove_cvref_t<Tuple>>::value; } and
+         is_applicable<Func, Tuple>(
+            std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<Tuple>>>());
+   } // namespace detail
+
+   /**
+    * @brief Functor used to implement the 'apply' operation on maybe & result monads
+    *
+    * 'apply(func, m1, m2, ...)' calls 'func' with the values of all the monads if every one of
+    * them holds a value, checking all the discriminants with a single branch. Maybe monads
+    * produce a maybe of the result of 'func', result monads a result of it or the first error
+    * found. Monads passed as rvalues have their payloads moved straight into the call.
+    *
+    * When piped, as in 'm | apply(func)', the value of the monad must be a tuple which is
+    * unpacked into the call. It is meant to follow a 'zip'.
+    */
+   struct apply_fn
+   {
+      template <typename Func, typename... Monads>
+         requires tag_invocable<apply_fn, Func, Monads...>
+      constexpr auto operator()(Func&& func, Monads&&... ms) const
+         noexcept(nothrow_tag_invocable<apply_fn, Func, Monads...>)
+            -> tag_invoke_result_t<apply_fn, Func, Monads...>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Func>(func), std::forward<Monads>(ms)...);
+      }
+
+      template <typename Func, typename... Monads>
+         requires(sizeof...(Monads) >= 1) and (not detail::any_monad<Func>) and
+         (not tag_invocable<apply_fn, Func, Monads...>) and detail::all_maybe_monads<Monads...> and
+         std::invocable<Func, detail::forward_value_t<Monads>...>
+      constexpr auto operator()(Func&& func, Monads&&... ms) const
+      {
+         using res_t = maybe<std::invoke_result_t<Func, detail::forward_value_t<Monads>...>>;
+
+         if (detail::all_some(ms...))
+         {
+            return res_t(some(std::invoke(std::forward<Func>(func),
+                                          detail::forward_value(std::forward<Monads>(ms))...)));
+         }
+
+         return res_t(none);
+      }
+
+      template <typename Func, typename... Monads>
+         requires(sizeof...(Monads) >= 1) and (not detail::any_monad<Func>) and
+         (not tag_invocable<apply_fn, Func, Monads...>) and detail::all_result_monads<Monads...> and
+         std::invocable<Func, detail::forward_value_t<Monads>...>
+      constexpr auto operator()(Func&& func, Monads&&... ms) const
+      {
+         using error_t = detail::common_error_t<Monads...>;
+         using res_t =
+            result<std::invoke_result_t<Func, detail::forward_value_t<Monads>...>, error_t>;
+
+         if (detail::all_ok(ms...))
+         {
+            return res_t(ok(std::invoke(std::forward<Func>(func),
+                                        detail::forward_value(std::forward<Monads>(ms))...)));
+         }
+
+         return res_t(err(detail::first_error<error_t>(std::forward<Monads>(ms)...)));
+      }
+
+      template <typename Monad, typename Func>
+         requires maybe_monad<std::remove_cvref_t<Monad>> and (not detail::any_monad<Func>) and
+         (not tag_invocable<apply_fn, Monad, Func>) and
+         detail::applicable<Func, detail::forward_value_t<Monad>>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+      {
+         using res_t = maybe<decltype(std::apply(std::forward<Func>(func),
+                                                 detail::forward_value(std::forward<Monad>(m))))>;
+
+         if (m.is_some())
+         {
+            return res_t(some(std::apply(std::forward<Func>(func),
+                                         detail::forward_value(std::forward<Monad>(m)))));
+         }
+
+         return res_t(none);
+      }
+
+      template <typename Monad, typename Func>
+         requires result_monad<std::remove_cvref_t<Monad>> and (not detail::any_monad<Func>) and
+         (not tag_invocable<apply_fn, Monad, Func>) and
+         detail::applicable<Func, detail::forward_value_t<Monad>>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+      {
+         using value_t = decltype(std::apply(std::forward<Func>(func),
+                                             detail::forward_value(std::forward<Monad>(m))));
+         using res_t = result<value_t, typename std::remove_cvref_t<Monad>::error_type>;
+
+         if (m.is_ok())
+         {
+            return res_t(ok(std::apply(std::forward<Func>(func),
+                                       detail::forward_value(std::forward<Monad>(m)))));
+         }
+
+         return res_t(err(detail::forward_error(std::forward<Monad>(m))));
+      }
+   };
+
+   /**
+    * @brief Call a function with the values of one or more monads.
+    *
+    * May be called directly, as in 'apply(func, m1, m2)', or piped onto a monad holding a tuple,
+    * as in 'zip(m1, m2) | apply(func)'.
+    */
+   const constexpr operation<apply_fn> apply = {};
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_OPERATIONS_APPLY_HPP
@@ -0,0 +1,127 @@
+/**
+ * @file operations/match.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the 'match' operation
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_OPERATIONS_MATCH_HPP
+#define LIBREGLISSE_OPERATIONS_MATCH_HPP
+
+#include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
+
+#include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      template <typename Monad, typename... Funcs>
+      concept member_matchable = requires(Monad&& m, Funcs&&... funcs)
+      {
+         std::forward<Monad>(m).match(std::forward<Funcs>(funcs)...);
+      };
+   } // namespace detail
+
+   /**
+    * @brief Functor used to implement the 'match' operation
+    *
+    * 'match(m, on_value, on_other)' calls one of the functions with the payload held by the monad,
+    * testing its discriminant a single time. The payload is moved into the function if the monad
+    * is an rvalue. Maybe monads call 'on_other' without arguments when they are empty, result
+    * monads call it with their error & either monads with their right value.
+    *
+    * Types with a 'match' member function, such as the monads of the library, use it. Other types
+    * modeling the monad concepts go through their accessors. The operation may be customized for
+    * a user defined type by providing a 'tag_invoke' overload.
+    */
+   struct match_fn
+   {
+      template <typename Monad, typename... Funcs>
+         requires tag_invocable<match_fn, Monad, Funcs...>
+      constexpr auto operator()(Monad&& m, Funcs&&... funcs) const
+         noexcept(nothrow_tag_invocable<match_fn, Monad, Funcs...>)
+            -> tag_invoke_result_t<match_fn, Monad, Funcs...>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Funcs>(funcs)...);
+      }
+
+      template <typename Monad, typename... Funcs>
+         requires(not tag_invocable<match_fn, Monad, Funcs...>) and
+         detail::member_matchable<Monad, Funcs...>
+      constexpr auto operator()(Monad&& m, Funcs&&... funcs) const -> decltype(auto)
+      {
+         return std::forward<Monad>(m).match(std::forward<Funcs>(funcs)...);
+      }
+
+      template <maybe_monad Monad, std::invocable<detail::forward_value_t<Monad>> OnSome,
+                std::invocable<> OnNone>
+         requires(not tag_invocable<match_fn, Monad, OnSome, OnNone>) and
+         (not detail::member_matchable<Monad, OnSome, OnNone>)
+      constexpr auto operator()(Monad&& m, OnSome&& on_some, OnNone&& on_none) const
+         -> std::common_type_t<std::invoke_result_t<OnSome, detail::forward_value_t<Monad>>,
+                               std::invoke_result_t<OnNone>>
+      {
+         if (m.is_some())
+         {
+            return std::invoke(std::forward<OnSome>(on_some),
+                               detail::forward_value(std::forward<Monad>(m)));
+         }
+
+         return std::invoke(std::forward<OnNone>(on_none));
+      }
+
+      template <result_monad Monad, std::invocable<detail::forward_value_t<Monad>> OnOk,
+                std::invocable<detail::forward_error_t<Monad>> OnErr>
+         requires(not tag_invocable<match_fn, Monad, OnOk, OnErr>) and
+         (not detail::member_matchable<Monad, OnOk, OnErr>)
+      constexpr auto operator()(Monad&& m, OnOk&& on_ok, OnErr&& on_err) const
+         -> std::common_type_t<std::invoke_result_t<OnOk, detail::forward_value_t<Monad>>,
+                               std::invoke_result_t<OnErr, detail::forward_error_t<Monad>>>
+      {
+         if (m.is_ok())
+         {
+            return std::invoke(std::forward<OnOk>(on_ok),
+                               detail::forward_value(std::forward<Monad>(m)));
+         }
+
+         return std::invoke(std::forward<OnErr>(on_err),
+                            detail::forward_error(std::forward<Monad>(m)));
+      }
+
+      template <either_monad Monad, std::invocable<detail::forward_left_t<Monad>> OnLeft,
+                std::invocable<detail::forward_right_t<Monad>> OnRight>
+         requires(not tag_invocable<match_fn, Monad, OnLeft, OnRight>) and
+         (not detail::member_matchable<Monad, OnLeft, OnRight>)
+      constexpr auto operator()(Monad&& m, OnLeft&& on_left, OnRight&& on_right) const
+         -> std::common_type_t<std::invoke_result_t<OnLeft, detail::forward_left_t<Monad>>,
+                               std::invoke_result_t<OnRight, detail::forward_right_t<Monad>>>
+      {
+         if (m.is_left())
+         {
+            return std::invoke(std::forward<OnLeft>(on_left),
+                               detail::forward_left(std::forward<Monad>(m)));
+         }
+
+         return std::invoke(std::forward<OnRight>(on_right),
+                            detail::forward_right(std::forward<Monad>(m)));
+      }
+   };
+
+   /**
+    * @brief Extract a value from a monad by calling the function matching the payload it holds.
+    *
+    * May be called directly, as in 'match(m, on_value, on_other)', or through a pipe, as in
+    * 'm | match(on_value, on_other)'.
+    */
+   const constexpr operation<match_fn> match = {};
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_OPERATIONS_MATCH_HPP
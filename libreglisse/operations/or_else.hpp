@@ -10,10 +10,16 @@
 #define LIBREGLISSE_OPERATIONS_OR_ELSE_HPP
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
 #include <libreglisse/maybe.hpp>
 #include <libreglisse/result.hpp>
 
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
+
+#if defined(LIBREGLISSE_USE_INSTRUMENTATION)
+#   include <libreglisse/instrumentation.hpp>
+#endif // defined(LIBREGLISSE_USE_INSTRUMENTATION)
 
 #include <type_traits>
 
@@ -33,12 +39,24 @@ namespace reglisse::inline v0
 
    /**
     * @brief Functor used to implement the 'or_else' operation on maybe & result monads
+    *
+    * Types modeling 'maybe_monad' or 'result_monad' are supported and produce a libreglisse monad.
+    * The operation may be customized for a user defined type by providing a 'tag_invoke' overload.
     */
    struct or_else_fn
    {
+      template <typename Monad, typename Func>
+         requires tag_invocable<or_else_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<or_else_fn, Monad, Func>)
+            -> tag_invoke_result_t<or_else_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
       template <typename ValueType, std::invocable Func>
          requires detail::ensure_or_else_returns_valid_maybe<Func, ValueType>
-      constexpr auto operator()(const maybe<ValueType>&& m, Func none_func) const
+      constexpr auto operator()(const maybe<ValueType>&& m, Func&& none_func) const
          -> maybe<ValueType>
       {
          if (m.is_some())
@@ -50,7 +68,7 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, std::invocable Func>
          requires detail::ensure_or_else_returns_valid_maybe<Func, ValueType>
-      constexpr auto operator()(maybe<ValueType>&& m, Func none_func) const -> maybe<ValueType>
+      constexpr auto operator()(maybe<ValueType>&& m, Func&& none_func) const -> maybe<ValueType>
       {
          if (m.is_some())
          {
@@ -61,7 +79,8 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, std::invocable Func>
          requires detail::ensure_or_else_returns_valid_maybe<Func, ValueType>
-      constexpr auto operator()(const maybe<ValueType>& m, Func none_func) const -> maybe<ValueType>
+      constexpr auto operator()(const maybe<ValueType>& m, Func&& none_func) const
+         -> maybe<ValueType>
       {
          if (m.is_some())
          {
@@ -72,7 +91,7 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, std::invocable Func>
          requires detail::ensure_or_else_returns_valid_maybe<Func, ValueType>
-      constexpr auto operator()(maybe<ValueType>& m, Func none_func) const -> maybe<ValueType>
+      constexpr auto operator()(maybe<ValueType>& m, Func&& none_func) const -> maybe<ValueType>
       {
          if (m.is_some())
          {
@@ -84,7 +103,7 @@ namespace reglisse::inline v0
 
       template <typename ValueType, typename ErrorType, std::invocable<ErrorType> Func>
          requires detail::ensure_or_else_returns_valid_result<Func, ValueType, ErrorType>
-      constexpr auto operator()(result<ValueType, ErrorType>&& r, Func&& err_func)
+      constexpr auto operator()(result<ValueType, ErrorType>&& r, Func&& err_func) const
       {
          using res_t = std::invoke_result_t<Func, ErrorType>;
 
@@ -97,7 +116,7 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, typename ErrorType, std::invocable<ErrorType> Func>
          requires detail::ensure_or_else_returns_valid_result<Func, ValueType, ErrorType>
-      constexpr auto operator()(const result<ValueType, ErrorType>&& r, Func&& err_func)
+      constexpr auto operator()(const result<ValueType, ErrorType>&& r, Func&& err_func) const
       {
          using res_t = std::invoke_result_t<Func, ErrorType>;
 
@@ -110,7 +129,7 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, typename ErrorType, std::invocable<ErrorType> Func>
          requires detail::ensure_or_else_returns_valid_result<Func, ValueType, ErrorType>
-      constexpr auto operator()(const result<ValueType, ErrorType>& r, Func&& err_func)
+      constexpr auto operator()(const result<ValueType, ErrorType>& r, Func&& err_func) const
       {
          using res_t = std::invoke_result_t<Func, ErrorType>;
 
@@ -123,7 +142,7 @@ namespace reglisse::inline v0
       }
       template <typename ValueType, typename ErrorType, std::invocable<ErrorType> Func>
          requires detail::ensure_or_else_returns_valid_result<Func, ValueType, ErrorType>
-      constexpr auto operator()(result<ValueType, ErrorType>& r, Func&& err_func)
+      constexpr auto operator()(result<ValueType, ErrorType>& r, Func&& err_func) const
       {
          using res_t = std::invoke_result_t<Func, ErrorType>;
 
@@ -134,12 +153,48 @@ namespace reglisse::inline v0
 
          return std::invoke(std::forward<Func>(err_func), r.borrow_err());
       }
+
+      template <maybe_monad Monad, std::invocable Func>
+         requires(not tag_invocable<or_else_fn, Monad, Func>) and
+         detail::ensure_or_else_returns_valid_maybe<Func,
+                                                    typename std::remove_cvref_t<Monad>::value_type>
+      constexpr auto operator()(Monad&& m, Func&& none_func) const
+         -> maybe<typename std::remove_cvref_t<Monad>::value_type>
+      {
+         if (m.is_some())
+         {
+            return some(detail::forward_value(std::forward<Monad>(m)));
+         }
+
+         return std::invoke(std::forward<Func>(none_func));
+      }
+      template <result_monad Monad, typename Func>
+         requires(not tag_invocable<or_else_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_error_t<Monad>> and
+         detail::ensure_or_else_returns_valid_result<
+            Func, typename std::remove_cvref_t<Monad>::value_type, detail::forward_error_t<Monad>>
+      constexpr auto operator()(Monad&& m, Func&& err_func) const
+      {
+         using res_t = std::invoke_result_t<Func, detail::forward_error_t<Monad>>;
+
+         if (m.is_ok())
+         {
+            return res_t(ok(detail::forward_value(std::forward<Monad>(m))));
+         }
+
+         return std::invoke(std::forward<Func>(err_func),
+                            detail::forward_error(std::forward<Monad>(m)));
+      }
    };
 
    /**
     * @brief The 'or_else' operation used on maybe & result.
     */
+#if defined(LIBREGLISSE_USE_INSTRUMENTATION)
+   const constexpr instrumented_operation<or_else_fn, call_site_kind::or_else> or_else = {};
+#else
    const constexpr operation<or_else_fn> or_else = {};
+#endif // defined(LIBREGLISSE_USE_INSTRUMENTATION)
 } // namespace reglisse::v0
 
 #endif // LIBREGLISSE_OPERATIONS_OR_ELSE_HPP
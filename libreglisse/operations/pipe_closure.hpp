@@ -3,8 +3,13 @@
 
 #include <libreglisse/concepts.hpp>
 
+#if defined(LIBREGLISSE_USE_TRACING)
+#   include <libreglisse/tracing.hpp>
+#endif // defined(LIBREGLISSE_USE_TRACING)
+
 #include <concepts>
 #include <functional>
+#include <type_traits>
 #include <utility>
 
 namespace reglisse::inline v0
@@ -28,6 +33,68 @@ namespace reglisse::inline v0
       {
          return forwarding_wrapper<Type>(std::forward<Type>(val));
       }
+
+      /**
+       * @brief Converts values of foreign types to the monad they map to before an operation is
+       * applied to them, such as a 'std::optional' to a 'maybe'. Other values are forwarded as
+       * they are. Specialized next to the monads.
+       */
+      template <typename Type>
+      struct monad_adaptor
+      {
+         template <typename U>
+         static constexpr auto adopt(U&& value) noexcept -> U&&
+         {
+            return std::forward<U>(value);
+         }
+      };
+
+      template <typename Type>
+      constexpr auto adopt(Type&& value) -> decltype(auto)
+      {
+         return monad_adaptor<std::remove_cvref_t<Type>>::adopt(std::forward<Type>(value));
+      }
+
+      template <typename Type>
+      using adopted_t = decltype(detail::adopt(std::declval<Type>()));
+
+      template <typename OpFunctor, typename... Args>
+      struct is_operation_invocable : std::false_type
+      {
+      };
+
+      template <typename OpFunctor, typename Monad, typename... Args>
+      struct is_operation_invocable<OpFunctor, Monad, Args...> :
+         std::bool_constant<std::invocable<OpFunctor, adopted_t<Monad>, Args...>>
+      {
+      };
+
+      /**
+       * @brief Check that an operation may be applied to a monad, once adopted, & arguments.
+       */
+      template <typename OpFunctor, typename... Args>
+      concept operation_invocable = is_operation_invocable<OpFunctor, Args...>::value;
+
+      /**
+       * @brief Call an operation with the arguments stored in a closure. They are passed as const
+       * lvalues when the operation accepts them, and copied otherwise, since a closure may be
+       * applied more than once.
+       */
+      template <typename OpFunctor, typename Monad, typename... Types>
+         requires std::invocable<OpFunctor, adopted_t<Monad>, const Types&...>
+      constexpr auto call_with_wrapped(Monad&& m, const forwarding_wrapper<Types>&... wrapped)
+         -> decltype(auto)
+      {
+         return OpFunctor()(detail::adopt(std::forward<Monad>(m)), wrapped.value...);
+      }
+      template <typename OpFunctor, typename Monad, typename... Types>
+         requires(not std::invocable<OpFunctor, adopted_t<Monad>, const Types&...>) and
+         std::invocable<OpFunctor, adopted_t<Monad>, Types...>
+      constexpr auto call_with_wrapped(Monad&& m, const forwarding_wrapper<Types>&... wrapped)
+         -> decltype(auto)
+      {
+         return OpFunctor()(detail::adopt(std::forward<Monad>(m)), wrapped.get()...);
+      }
    } // namespace detail
 
    template <typename Func>
@@ -46,30 +113,62 @@ namespace reglisse::inline v0
 
    /**
     * @brief Functor used to define operations for monadic types.
+    *
+    * Calling the operation with all of its arguments, monad included, invokes the underlying
+    * functor directly. Calling it without the monad creates a closure that may be applied through
+    * the pipe operator.
+    *
+    * When 'LIBREGLISSE_USE_TRACING' is defined, every application of the operation to a monad is
+    * traced as a stage named after the operation & its callable, see 'tracing.hpp'.
+    *
+    * Values of foreign types with a 'detail::monad_adaptor', such as 'std::optional', are converted
+    * to the matching monad before the operation is applied to them.
     */
    template <typename OpFunctor>
    struct operation
    {
+      template <typename Monad, typename... Args>
+         requires detail::operation_invocable<OpFunctor, Monad, Args...>
+      constexpr auto operator()(Monad&& m, Args&&... args) const -> decltype(auto)
+      {
+#if defined(LIBREGLISSE_USE_TRACING)
+         const detail::trace_scope scope(detail::operation_name_storage<OpFunctor>.data(),
+                                         detail::callable_name(args...));
+#endif // defined(LIBREGLISSE_USE_TRACING)
+
+         return OpFunctor()(detail::adopt(std::forward<Monad>(m)), std::forward<Args>(args)...);
+      }
+
       template <typename... Params>
+         requires(not detail::operation_invocable<OpFunctor, Params...>)
       constexpr auto operator()(Params... values) const
       {
-         const auto test = [](auto... wrapped_values) {
-            return [=]<monad T>(T&& m) -> decltype(auto) {
-               return OpFunctor()(std::forward<T>(m), wrapped_values.get()...);
+         auto closure = [](auto... wrappers) {
+            return [... wrapped_values = std::move(wrappers)]<typename T>(T&& m)
+                      -> decltype(detail::call_with_wrapped<OpFunctor>(std::forward<T>(m),
+                                                                       wrappers...)) {
+#if defined(LIBREGLISSE_USE_TRACING)
+               const detail::trace_scope scope(detail::operation_name_storage<OpFunctor>.data(),
+                                               detail::callable_name(wrapped_values.value...));
+#endif // defined(LIBREGLISSE_USE_TRACING)
+
+               return detail::call_with_wrapped<OpFunctor>(std::forward<T>(m), wrapped_values...);
             };
-         }(detail::make_forwarding_wrapper(std::forward<Params>(values)...));
+         }(detail::make_forwarding_wrapper(std::forward<Params>(values))...);
 
-         return make_pipe_closure(test);
+         return make_pipe_closure(std::move(closure));
       }
    };
 
-   template <monad T, typename Func>
+   template <typename T, typename Func>
+      requires std::invocable<const pipe_closure<Func>&, T>
    constexpr auto operator|(T&& val, const pipe_closure<Func>& closure) -> decltype(auto)
    {
       return closure(std::forward<T>(val));
    }
 
-   template <monad T, typename Func>
+   template <typename T, typename Func>
+      requires std::invocable<std::invoke_result_t<const operation<Func>&>, T>
    constexpr auto operator|(T&& val, const operation<Func>& operation) -> decltype(auto)
    {
       return operation()(std::forward<T>(val));
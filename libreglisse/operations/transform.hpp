@@ -10,20 +10,34 @@
 #define LIBREGLISSE_OPERATIONS_TRANSFORM_HPP
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
 #include <libreglisse/maybe.hpp>
 #include <libreglisse/result.hpp>
 
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
 
 namespace reglisse::inline v0
 {
    /**
     * @brief Functor used to implement the 'transform' operation on maybe & result monads
+    *
+    * Types modeling 'maybe_monad' or 'result_monad' are supported and produce a libreglisse monad.
+    * The operation may be customized for a user defined type by providing a 'tag_invoke' overload.
     */
    struct transform_fn
    {
+      template <typename Monad, typename Func>
+         requires tag_invocable<transform_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<transform_fn, Monad, Func>)
+            -> tag_invoke_result_t<transform_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
       template <typename ValueType, std::invocable<ValueType> Func>
-      constexpr auto operator()(const maybe<ValueType>&& m, Func&& ok_func)
+      constexpr auto operator()(const maybe<ValueType>&& m, Func&& ok_func) const
       {
          using res_t = maybe<std::invoke_result_t<Func, ValueType>>;
 
@@ -35,7 +49,7 @@ namespace reglisse::inline v0
          return res_t(none);
       }
       template <typename ValueType, std::invocable<ValueType> Func>
-      constexpr auto operator()(maybe<ValueType>&& m, Func&& ok_func)
+      constexpr auto operator()(maybe<ValueType>&& m, Func&& ok_func) const
       {
          using res_t = maybe<std::invoke_result_t<Func, ValueType>>;
 
@@ -47,7 +61,7 @@ namespace reglisse::inline v0
          return res_t(none);
       }
       template <typename ValueType, std::invocable<ValueType> Func>
-      constexpr auto operator()(const maybe<ValueType>& m, Func&& ok_func)
+      constexpr auto operator()(const maybe<ValueType>& m, Func&& ok_func) const
       {
          using res_t = maybe<std::invoke_result_t<Func, ValueType>>;
 
@@ -59,7 +73,7 @@ namespace reglisse::inline v0
          return res_t(none);
       }
       template <typename ValueType, std::invocable<ValueType> Func>
-      constexpr auto operator()(maybe<ValueType>& m, Func&& ok_func)
+      constexpr auto operator()(maybe<ValueType>& m, Func&& ok_func) const
       {
          using res_t = maybe<std::invoke_result_t<Func, ValueType>>;
 
@@ -72,7 +86,7 @@ namespace reglisse::inline v0
       }
 
       template <typename OkType, typename ErrType, std::invocable<OkType> Func>
-      constexpr auto operator()(const result<OkType, ErrType>&& r, Func&& ok_func)
+      constexpr auto operator()(const result<OkType, ErrType>&& r, Func&& ok_func) const
       {
          using res_t = result<std::invoke_result_t<Func, OkType>, ErrType>;
 
@@ -84,7 +98,7 @@ namespace reglisse::inline v0
          return res_t(err(std::move(r).take_err()));
       }
       template <typename OkType, typename ErrType, std::invocable<OkType> Func>
-      constexpr auto operator()(result<OkType, ErrType>&& r, Func&& ok_func)
+      constexpr auto operator()(result<OkType, ErrType>&& r, Func&& ok_func) const
       {
          using res_t = result<std::invoke_result_t<Func, OkType>, ErrType>;
 
@@ -97,7 +111,7 @@ namespace reglisse::inline v0
       }
 
       template <typename OkType, typename ErrType, std::invocable<OkType> Func>
-      constexpr auto operator()(const result<OkType, ErrType>& r, Func&& ok_func)
+      constexpr auto operator()(const result<OkType, ErrType>& r, Func&& ok_func) const
       {
          using res_t = result<std::invoke_result_t<Func, OkType>, ErrType>;
 
@@ -109,7 +123,7 @@ namespace reglisse::inline v0
          return res_t(err(r.borrow_err()));
       }
       template <typename OkType, typename ErrType, std::invocable<OkType> Func>
-      constexpr auto operator()(result<OkType, ErrType>& r, Func&& ok_func)
+      constexpr auto operator()(result<OkType, ErrType>& r, Func&& ok_func) const
       {
          using res_t = result<std::invoke_result_t<Func, OkType>, ErrType>;
 
@@ -120,6 +134,38 @@ namespace reglisse::inline v0
 
          return res_t(err(r.borrow_err()));
       }
+
+      template <maybe_monad Monad, typename Func>
+         requires(not tag_invocable<transform_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_value_t<Monad>>
+      constexpr auto operator()(Monad&& m, Func&& ok_func) const
+      {
+         using res_t = maybe<std::invoke_result_t<Func, detail::forward_value_t<Monad>>>;
+
+         if (m.is_some())
+         {
+            return res_t(some(std::invoke(std::forward<Func>(ok_func),
+                                          detail::forward_value(std::forward<Monad>(m)))));
+         }
+
+         return res_t(none);
+      }
+      template <result_monad Monad, typename Func>
+         requires(not tag_invocable<transform_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_value_t<Monad>>
+      constexpr auto operator()(Monad&& m, Func&& ok_func) const
+      {
+         using res_t = result<std::invoke_result_t<Func, detail::forward_value_t<Monad>>,
+                              typename std::remove_cvref_t<Monad>::error_type>;
+
+         if (m.is_ok())
+         {
+            return res_t(ok(std::invoke(std::forward<Func>(ok_func),
+                                        detail::forward_value(std::forward<Monad>(m)))));
+         }
+
+         return res_t(err(detail::forward_error(std::forward<Monad>(m))));
+      }
    };
 
    /**
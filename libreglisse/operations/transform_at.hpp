@@ -0,0 +1,128 @@
+/**
+ * @file operations/transform_at.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the 'transform_at' operation
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_OPERATIONS_TRANSFORM_AT_HPP
+#define LIBREGLISSE_OPERATIONS_TRANSFORM_AT_HPP
+
+#include <libreglisse/sum.hpp>
+
+#include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      template <typename Type>
+      struct is_sum : std::false_type
+      {
+      };
+
+      template <typename... Types>
+      struct is_sum<sum<Types...>> : std::true_type
+      {
+      };
+
+      template <typename Type>
+      concept any_sum = is_sum<std::remove_cvref_t<Type>>::value;
+
+      template <std::size_t Index, typename New, typename Sum, typename Indices>
+      struct replace_alternative;
+
+      template <std::size_t Index, typename New, typename... Types, std::size_t... Indices>
+      struct replace_alternative<Index, New, sum<Types...>, std::index_sequence<Indices...>>
+      {
+         using type = sum<std::conditional_t<Indices == Index, New, Types>...>;
+      };
+
+      /**
+       * @brief The sum obtained by replacing the alternative at 'Index' of 'Sum' by 'New'.
+       */
+      template <std::size_t Index, typename New, typename Sum>
+      using replace_alternative_t = typename replace_alternative<
+         Index, New, Sum, std::make_index_sequence<Sum::alternative_count>>::type;
+
+      /**
+       * @brief Access the alternative at 'Index' of a sum, moving it out if the sum is an rvalue.
+       */
+      template <std::size_t Index, typename Monad>
+      constexpr auto forward_alternative(Monad&& m) -> decltype(auto)
+      {
+         if constexpr (std::is_lvalue_reference_v<Monad>)
+         {
+            return m.template borrow<Index>();
+         }
+         else
+         {
+            return std::move(m).template take<Index>();
+         }
+      }
+
+      template <std::size_t Index, typename Monad>
+      using forward_alternative_t = decltype(forward_alternative<Index>(std::declval<Monad>()));
+   } // namespace detail
+
+   /**
+    * @brief Functor used to implement the 'transform_at' operation on sum monads
+    *
+    * The alternative at 'Index' is transformed if the monad holds it, any other alternative is
+    * carried over to the same position of the resulting sum. The operation may be customized for a
+    * user defined type by providing a 'tag_invoke' overload.
+    */
+   template <std::size_t Index>
+   struct transform_at_fn
+   {
+      template <typename Monad, typename Func>
+         requires tag_invocable<transform_at_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<transform_at_fn, Monad, Func>)
+            -> tag_invoke_result_t<transform_at_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
+      template <detail::any_sum Monad, typename Func>
+         requires(not tag_invocable<transform_at_fn, Monad, Func>) and
+         (Index < std::remove_cvref_t<Monad>::alternative_count) and
+         std::invocable<Func, detail::forward_alternative_t<Index, Monad>>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+      {
+         using sum_t = std::remove_cvref_t<Monad>;
+         using ret_t = detail::replace_alternative_t<
+            Index, std::invoke_result_t<Func, detail::forward_alternative_t<Index, Monad>>, sum_t>;
+
+         return detail::dispatch<sum_t::alternative_count>(
+            m.index(), [&]<std::size_t I>(detail::index_constant<I>) -> ret_t {
+               if constexpr (I == Index)
+               {
+                  return ret_t(std::in_place_index<I>,
+                               std::invoke(std::forward<Func>(func),
+                                           detail::forward_alternative<I>(std::forward<Monad>(m))));
+               }
+               else
+               {
+                  return ret_t(std::in_place_index<I>,
+                               detail::forward_alternative<I>(std::forward<Monad>(m)));
+               }
+            });
+      }
+   };
+
+   /**
+    * @brief Transform the alternative at 'Index' of a sum monad, if it is the one held.
+    */
+   template <std::size_t Index>
+   const constexpr operation<transform_at_fn<Index>> transform_at = {};
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_OPERATIONS_TRANSFORM_AT_HPP
@@ -10,19 +10,33 @@
 #define LIBREGLISSE_OPERATIONS_TRANSFORM_ERR_HPP
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
 #include <libreglisse/result.hpp>
 
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
 
 namespace reglisse::inline v0
 {
    /**
     * @brief Functor used to implement the 'transform_err' operation on maybe & result monads
+    *
+    * Types modeling 'result_monad' are supported and produce a libreglisse result. The operation
+    * may be customized for a user defined type by providing a 'tag_invoke' overload.
     */
    struct transform_err_fn
    {
+      template <typename Monad, typename Func>
+         requires tag_invocable<transform_err_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<transform_err_fn, Monad, Func>)
+            -> tag_invoke_result_t<transform_err_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
       template <typename OkType, typename ErrType, std::invocable<ErrType> Func>
-      constexpr auto operator()(const result<OkType, ErrType>&& r, Func&& err_func)
+      constexpr auto operator()(const result<OkType, ErrType>&& r, Func&& err_func) const
          -> result<OkType, std::invoke_result_t<Func, ErrType>>
       {
          if (r.is_err())
@@ -33,7 +47,7 @@ namespace reglisse::inline v0
          return ok(std::move(r).take());
       }
       template <typename OkType, typename ErrType, std::invocable<ErrType> Func>
-      constexpr auto operator()(result<OkType, ErrType>&& r, Func&& err_func)
+      constexpr auto operator()(result<OkType, ErrType>&& r, Func&& err_func) const
          -> result<OkType, std::invoke_result_t<Func, ErrType>>
       {
          if (r.is_err())
@@ -44,7 +58,7 @@ namespace reglisse::inline v0
          return ok(std::move(r).take());
       }
       template <typename OkType, typename ErrType, std::invocable<ErrType> Func>
-      constexpr auto operator()(const result<OkType, ErrType>& r, Func&& err_func)
+      constexpr auto operator()(const result<OkType, ErrType>& r, Func&& err_func) const
          -> result<OkType, std::invoke_result_t<Func, ErrType>>
       {
          if (r.is_err())
@@ -55,7 +69,7 @@ namespace reglisse::inline v0
          return ok(r.borrow());
       }
       template <typename OkType, typename ErrType, std::invocable<ErrType> Func>
-      constexpr auto operator()(result<OkType, ErrType>& r, Func&& err_func)
+      constexpr auto operator()(result<OkType, ErrType>& r, Func&& err_func) const
          -> result<OkType, std::invoke_result_t<Func, ErrType>>
       {
          if (r.is_err())
@@ -63,7 +77,23 @@ namespace reglisse::inline v0
             return err(std::invoke(std::forward<Func>(err_func), r.borrow_err()));
          }
 
-         return ok(r.borrow);
+         return ok(r.borrow());
+      }
+
+      template <result_monad Monad, typename Func>
+         requires(not tag_invocable<transform_err_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_error_t<Monad>>
+      constexpr auto operator()(Monad&& m, Func&& err_func) const
+         -> result<typename std::remove_cvref_t<Monad>::value_type,
+                   std::invoke_result_t<Func, detail::forward_error_t<Monad>>>
+      {
+         if (m.is_err())
+         {
+            return err(std::invoke(std::forward<Func>(err_func),
+                                   detail::forward_error(std::forward<Monad>(m))));
+         }
+
+         return ok(detail::forward_value(std::forward<Monad>(m)));
       }
    };
 
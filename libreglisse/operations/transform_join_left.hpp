@@ -10,9 +10,11 @@
 #define LIBREGLISSE_OPERATIONS_FLAT_TRANSFORM_LEFT_HPP
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
 #include <libreglisse/either.hpp>
 
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
 
 namespace reglisse::inline v0
 {
@@ -26,12 +28,24 @@ namespace reglisse::inline v0
 
    /**
     * @brief Functor used to implement the 'flat_transform_left' operation on either monads
+    *
+    * Types modeling 'either_monad' are supported and produce a libreglisse either. The operation
+    * may be customized for a user defined type by providing a 'tag_invoke' overload.
     */
    struct transform_join_left_fn
    {
+      template <typename Monad, typename Func>
+         requires tag_invocable<transform_join_left_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<transform_join_left_fn, Monad, Func>)
+            -> tag_invoke_result_t<transform_join_left_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
       template <typename LeftType, typename RightType, std::invocable<LeftType> Func>
          requires detail::ensure_transformjl_returns_valid_either<LeftType, RightType, Func>
-      constexpr auto operator()(const either<LeftType, RightType>&& e, Func&& left_func)
+      constexpr auto operator()(const either<LeftType, RightType>&& e, Func&& left_func) const
       {
          using ret_t = std::invoke_result_t<Func, LeftType>;
 
@@ -44,7 +58,7 @@ namespace reglisse::inline v0
       }
       template <typename LeftType, typename RightType, std::invocable<LeftType> Func>
          requires detail::ensure_transformjl_returns_valid_either<LeftType, RightType, Func>
-      constexpr auto operator()(either<LeftType, RightType>&& e, Func&& left_func)
+      constexpr auto operator()(either<LeftType, RightType>&& e, Func&& left_func) const
       {
          using ret_t = std::invoke_result_t<Func, LeftType>;
 
@@ -58,7 +72,7 @@ namespace reglisse::inline v0
 
       template <typename LeftType, typename RightType, std::invocable<LeftType> Func>
          requires detail::ensure_transformjl_returns_valid_either<LeftType, RightType, Func>
-      constexpr auto operator()(const either<LeftType, RightType>& e, Func&& left_func)
+      constexpr auto operator()(const either<LeftType, RightType>& e, Func&& left_func) const
       {
          using ret_t = std::invoke_result_t<Func, LeftType>;
 
@@ -71,7 +85,7 @@ namespace reglisse::inline v0
       }
       template <typename LeftType, typename RightType, std::invocable<LeftType> Func>
          requires detail::ensure_transformjl_returns_valid_either<LeftType, RightType, Func>
-      constexpr auto operator()(either<LeftType, RightType>& e, Func&& left_func)
+      constexpr auto operator()(either<LeftType, RightType>& e, Func&& left_func) const
       {
          using ret_t = std::invoke_result_t<Func, LeftType>;
 
@@ -82,6 +96,24 @@ namespace reglisse::inline v0
 
          return ret_t(right(e.borrow_right()));
       }
+
+      template <either_monad Monad, typename Func>
+         requires(not tag_invocable<transform_join_left_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_left_t<Monad>> and
+         detail::ensure_transformjl_returns_valid_either<
+            detail::forward_left_t<Monad>, typename std::remove_cvref_t<Monad>::right_type, Func>
+      constexpr auto operator()(Monad&& e, Func&& left_func) const
+      {
+         using ret_t = std::invoke_result_t<Func, detail::forward_left_t<Monad>>;
+
+         if (e.is_left())
+         {
+            return std::invoke(std::forward<Func>(left_func),
+                               detail::forward_left(std::forward<Monad>(e)));
+         }
+
+         return ret_t(right(detail::forward_right(std::forward<Monad>(e))));
+      }
    };
 
    const constexpr operation<transform_join_left_fn> transform_join_left = {};
@@ -6,13 +6,15 @@
  * @copyright Copyright (C) 2021 wmbat.
  */
 
-#ifndef LIBREGLISSE_OPERATIONS_FLAT_TRANSFORM_LEFT_HPP
-#define LIBREGLISSE_OPERATIONS_FLAT_TRANSFORM_LEFT_HPP
+#ifndef LIBREGLISSE_OPERATIONS_FLAT_TRANSFORM_RIGHT_HPP
+#define LIBREGLISSE_OPERATIONS_FLAT_TRANSFORM_RIGHT_HPP
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
 #include <libreglisse/either.hpp>
 
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
 
 namespace reglisse::inline v0
 {
@@ -26,12 +28,24 @@ namespace reglisse::inline v0
 
    /**
     * @brief Functor used to implement the 'flat_transform_right' operation on either monads
+    *
+    * Types modeling 'either_monad' are supported and produce a libreglisse either. The operation
+    * may be customized for a user defined type by providing a 'tag_invoke' overload.
     */
    struct transform_join_right_fn
    {
+      template <typename Monad, typename Func>
+         requires tag_invocable<transform_join_right_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<transform_join_right_fn, Monad, Func>)
+            -> tag_invoke_result_t<transform_join_right_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
       template <typename LeftType, typename RightType, std::invocable<RightType> Func>
          requires detail::ensure_transformjr_returns_valid_either<LeftType, RightType, Func>
-      constexpr auto operator()(const either<LeftType, RightType>&& e, Func&& right_func)
+      constexpr auto operator()(const either<LeftType, RightType>&& e, Func&& right_func) const
       {
          using ret_t = std::invoke_result_t<Func, RightType>;
 
@@ -44,7 +58,7 @@ namespace reglisse::inline v0
       }
       template <typename LeftType, typename RightType, std::invocable<RightType> Func>
          requires detail::ensure_transformjr_returns_valid_either<LeftType, RightType, Func>
-      constexpr auto operator()(either<LeftType, RightType>&& e, Func&& right_func)
+      constexpr auto operator()(either<LeftType, RightType>&& e, Func&& right_func) const
       {
          using ret_t = std::invoke_result_t<Func, RightType>;
 
@@ -58,7 +72,7 @@ namespace reglisse::inline v0
 
       template <typename LeftType, typename RightType, std::invocable<RightType> Func>
          requires detail::ensure_transformjr_returns_valid_either<LeftType, RightType, Func>
-      constexpr auto operator()(const either<LeftType, RightType>& e, Func&& right_func)
+      constexpr auto operator()(const either<LeftType, RightType>& e, Func&& right_func) const
       {
          using ret_t = std::invoke_result_t<Func, RightType>;
 
@@ -71,7 +85,7 @@ namespace reglisse::inline v0
       }
       template <typename LeftType, typename RightType, std::invocable<RightType> Func>
          requires detail::ensure_transformjr_returns_valid_either<LeftType, RightType, Func>
-      constexpr auto operator()(either<LeftType, RightType>& e, Func&& right_func)
+      constexpr auto operator()(either<LeftType, RightType>& e, Func&& right_func) const
       {
          using ret_t = std::invoke_result_t<Func, RightType>;
 
@@ -82,9 +96,27 @@ namespace reglisse::inline v0
 
          return ret_t(left(e.borrow_left()));
       }
+
+      template <either_monad Monad, typename Func>
+         requires(not tag_invocable<transform_join_right_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_right_t<Monad>> and
+         detail::ensure_transformjr_returns_valid_either<
+            typename std::remove_cvref_t<Monad>::left_type, detail::forward_right_t<Monad>, Func>
+      constexpr auto operator()(Monad&& e, Func&& right_func) const
+      {
+         using ret_t = std::invoke_result_t<Func, detail::forward_right_t<Monad>>;
+
+         if (e.is_right())
+         {
+            return std::invoke(std::forward<Func>(right_func),
+                               detail::forward_right(std::forward<Monad>(e)));
+         }
+
+         return ret_t(left(detail::forward_left(std::forward<Monad>(e))));
+      }
    };
 
    const constexpr operation<transform_join_right_fn> transform_join_right = {};
 } // namespace reglisse::v0
 
-#endif // LIBREGLISSE_OPERATIONS_FLAT_TRANSFORM_LEFT_HPP
+#endif // LIBREGLISSE_OPERATIONS_FLAT_TRANSFORM_RIGHT_HPP
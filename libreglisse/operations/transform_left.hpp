@@ -10,19 +10,33 @@
 #define LIBREGLISSE_OPERATIONS_TRANSFORM_LEFT_HPP
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
 #include <libreglisse/either.hpp>
 
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
 
 namespace reglisse::inline v0
 {
    /**
     * @brief Functor used to implement the 'transform_left' operation on either monads
+    *
+    * Types modeling 'either_monad' are supported and produce a libreglisse either. The operation
+    * may be customized for a user defined type by providing a 'tag_invoke' overload.
     */
    struct transform_left_fn
    {
+      template <typename Monad, typename Func>
+         requires tag_invocable<transform_left_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<transform_left_fn, Monad, Func>)
+            -> tag_invoke_result_t<transform_left_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
       template <typename LeftType, typename RightType, std::invocable<LeftType> Func>
-      constexpr auto operator()(const either<LeftType, RightType>&& e, Func&& left_func)
+      constexpr auto operator()(const either<LeftType, RightType>&& e, Func&& left_func) const
       {
          using ret_t = either<std::invoke_result_t<Func, LeftType>, RightType>;
 
@@ -35,7 +49,7 @@ namespace reglisse::inline v0
          return ret_t(right(std::move(e).take_right()));
       }
       template <typename LeftType, typename RightType, std::invocable<LeftType> Func>
-      constexpr auto operator()(either<LeftType, RightType>&& e, Func&& left_func)
+      constexpr auto operator()(either<LeftType, RightType>&& e, Func&& left_func) const
       {
          using ret_t = either<std::invoke_result_t<Func, LeftType>, RightType>;
 
@@ -49,7 +63,7 @@ namespace reglisse::inline v0
       }
 
       template <typename LeftType, typename RightType, std::invocable<LeftType> Func>
-      constexpr auto operator()(const either<LeftType, RightType>& e, Func&& left_func)
+      constexpr auto operator()(const either<LeftType, RightType>& e, Func&& left_func) const
       {
          using ret_t = either<std::invoke_result_t<Func, LeftType>, RightType>;
 
@@ -61,7 +75,7 @@ namespace reglisse::inline v0
          return ret_t(right(e.borrow_right()));
       }
       template <typename LeftType, typename RightType, std::invocable<LeftType> Func>
-      constexpr auto operator()(either<LeftType, RightType>& e, Func&& left_func)
+      constexpr auto operator()(either<LeftType, RightType>& e, Func&& left_func) const
       {
          using ret_t = either<std::invoke_result_t<Func, LeftType>, RightType>;
 
@@ -72,6 +86,23 @@ namespace reglisse::inline v0
 
          return ret_t(right(e.borrow_right()));
       }
+
+      template <either_monad Monad, typename Func>
+         requires(not tag_invocable<transform_left_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_left_t<Monad>>
+      constexpr auto operator()(Monad&& e, Func&& left_func) const
+      {
+         using ret_t = either<std::invoke_result_t<Func, detail::forward_left_t<Monad>>,
+                              typename std::remove_cvref_t<Monad>::right_type>;
+
+         if (e.is_left())
+         {
+            return ret_t(left(std::invoke(std::forward<Func>(left_func),
+                                          detail::forward_left(std::forward<Monad>(e)))));
+         }
+
+         return ret_t(right(detail::forward_right(std::forward<Monad>(e))));
+      }
    };
 
    const constexpr operation<transform_left_fn> transform_left = {};
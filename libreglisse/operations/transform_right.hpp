@@ -10,19 +10,33 @@
 #define LIBREGLISSE_OPERATIONS_TRANSFORM_RIGHT_HPP
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
 #include <libreglisse/either.hpp>
 
 #include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
 
 namespace reglisse::inline v0
 {
    /**
     * @brief Functor used to implement the 'transform_left' operation on either monads
+    *
+    * Types modeling 'either_monad' are supported and produce a libreglisse either. The operation
+    * may be customized for a user defined type by providing a 'tag_invoke' overload.
     */
    struct transform_right_fn
    {
+      template <typename Monad, typename Func>
+         requires tag_invocable<transform_right_fn, Monad, Func>
+      constexpr auto operator()(Monad&& m, Func&& func) const
+         noexcept(nothrow_tag_invocable<transform_right_fn, Monad, Func>)
+            -> tag_invoke_result_t<transform_right_fn, Monad, Func>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Func>(func));
+      }
+
       template <typename LeftType, typename RightType, std::invocable<RightType> Func>
-      constexpr auto operator()(const either<LeftType, RightType>&& e, Func right_func)
+      constexpr auto operator()(const either<LeftType, RightType>&& e, Func&& right_func) const
       {
          using ret_t = either<LeftType, std::invoke_result_t<Func, RightType>>;
 
@@ -32,10 +46,10 @@ namespace reglisse::inline v0
                right(std::invoke(std::forward<Func>(right_func), std::move(e).take_right())));
          }
 
-         return ret_t(left(e.take_left()));
+         return ret_t(left(std::move(e).take_left()));
       }
       template <typename LeftType, typename RightType, std::invocable<RightType> Func>
-      constexpr auto operator()(either<LeftType, RightType>&& e, Func right_func)
+      constexpr auto operator()(either<LeftType, RightType>&& e, Func&& right_func) const
       {
          using ret_t = either<LeftType, std::invoke_result_t<Func, RightType>>;
 
@@ -45,10 +59,10 @@ namespace reglisse::inline v0
                right(std::invoke(std::forward<Func>(right_func), std::move(e).take_right())));
          }
 
-         return ret_t(left(e.take_left()));
+         return ret_t(left(std::move(e).take_left()));
       }
       template <typename LeftType, typename RightType, std::invocable<RightType> Func>
-      constexpr auto operator()(const either<LeftType, RightType>& e, Func right_func)
+      constexpr auto operator()(const either<LeftType, RightType>& e, Func&& right_func) const
       {
          using ret_t = either<LeftType, std::invoke_result_t<Func, RightType>>;
 
@@ -60,7 +74,7 @@ namespace reglisse::inline v0
          return ret_t(left(e.borrow_left()));
       }
       template <typename LeftType, typename RightType, std::invocable<RightType> Func>
-      constexpr auto operator()(either<LeftType, RightType>& e, Func right_func)
+      constexpr auto operator()(either<LeftType, RightType>& e, Func&& right_func) const
       {
          using ret_t = either<LeftType, std::invoke_result_t<Func, RightType>>;
 
@@ -71,6 +85,23 @@ namespace reglisse::inline v0
 
          return ret_t(left(e.borrow_left()));
       }
+
+      template <either_monad Monad, typename Func>
+         requires(not tag_invocable<transform_right_fn, Monad, Func>) and
+         std::invocable<Func, detail::forward_right_t<Monad>>
+      constexpr auto operator()(Monad&& e, Func&& right_func) const
+      {
+         using ret_t = either<typename std::remove_cvref_t<Monad>::left_type,
+                              std::invoke_result_t<Func, detail::forward_right_t<Monad>>>;
+
+         if (e.is_right())
+         {
+            return ret_t(right(std::invoke(std::forward<Func>(right_func),
+                                           detail::forward_right(std::forward<Monad>(e)))));
+         }
+
+         return ret_t(left(detail::forward_left(std::forward<Monad>(e))));
+      }
    };
 
    const constexpr operation<transform_right_fn> transform_right = {};
@@ -0,0 +1,143 @@
+/**
+ * @file operations/zip.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the 'zip' operation
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_OPERATIONS_ZIP_HPP
+#define LIBREGLISSE_OPERATIONS_ZIP_HPP
+
+#include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/tag_invoke.hpp>
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      template <typename... Monads>
+      concept all_maybe_monads = (maybe_monad<std::remove_cvref_t<Monads>> and ...);
+
+      template <typename... Monads>
+      using common_error_t =
+         std::common_type_t<typename std::remove_cvref_t<Monads>::error_type...>;
+
+      template <typename... Monads>
+      concept all_result_monads = (result_monad<std::remove_cvref_t<Monads>> and ...) and
+         requires { typename common_error_t<Monads...>; };
+
+      /**
+       * @brief Check if every monad holds a value. The discriminants are combined without
+       * short-circuiting so that a single branch is taken on the result.
+       */
+      template <typename... Monads>
+      constexpr auto all_some(const Monads&... ms) noexcept -> bool
+      {
+         return (static_cast<unsigned>(ms.is_some()) & ...) != 0U;
+      }
+      template <typename... Monads>
+      constexpr auto all_ok(const Monads&... ms) noexcept -> bool
+      {
+         return (static_cast<unsigned>(ms.is_ok()) & ...) != 0U;
+      }
+
+      /**
+       * @brief Get the first error held by a set of results. At least one of the results must
+       * hold an error.
+       */
+      template <typename Error, typename Monad, typename... Monads>
+      constexpr auto first_error(Monad&& m, Monads&&... ms) -> Error
+      {
+         if constexpr (sizeof...(Monads) == 0)
+         {
+            return Error(forward_error(std::forward<Monad>(m)));
+         }
+         else
+         {
+            if (m.is_err())
+            {
+               return Error(forward_error(std::forward<Monad>(m)));
+            }
+
+            return first_error<Error>(std::forward<Monads>(ms)...);
+         }
+      }
+   } // namespace detail
+
+   /**
+    * @brief Functor used to implement the 'zip' operation on maybe & result monads
+    *
+    * Two or more maybe monads are combined into a maybe of a tuple of their values, holding a
+    * value only if all of them do. Two or more result monads are combined into a result of a
+    * tuple of their values, or the first error found. Monads passed as rvalues have their
+    * payloads moved into the tuple.
+    */
+   struct zip_fn
+   {
+      template <typename Monad, typename... Monads>
+         requires tag_invocable<zip_fn, Monad, Monads...>
+      constexpr auto operator()(Monad&& m, Monads&&... ms) const
+         noexcept(nothrow_tag_invocable<zip_fn, Monad, Monads...>)
+            -> tag_invoke_result_t<zip_fn, Monad, Monads...>
+      {
+         return reglisse::tag_invoke(*this, std::forward<Monad>(m), std::forward<Monads>(ms)...);
+      }
+
+      template <typename Monad, typename... Monads>
+         requires(sizeof...(Monads) >= 1) and (not tag_invocable<zip_fn, Monad, Monads...>) and
+         detail::all_maybe_monads<Monad, Monads...>
+      constexpr auto operator()(Monad&& m, Monads&&... ms) const
+      {
+         using tuple_t = std::tuple<std::remove_cvref_t<detail::forward_value_t<Monad>>,
+                                    std::remove_cvref_t<detail::forward_value_t<Monads>>...>;
+         using res_t = maybe<tuple_t>;
+
+         if (detail::all_some(m, ms...))
+         {
+            return res_t(some(tuple_t(detail::forward_value(std::forward<Monad>(m)),
+                                      detail::forward_value(std::forward<Monads>(ms))...)));
+         }
+
+         return res_t(none);
+      }
+
+      template <typename Monad, typename... Monads>
+         requires(sizeof...(Monads) >= 1) and (not tag_invocable<zip_fn, Monad, Monads...>) and
+         detail::all_result_monads<Monad, Monads...>
+      constexpr auto operator()(Monad&& m, Monads&&... ms) const
+      {
+         using tuple_t = std::tuple<std::remove_cvref_t<detail::forward_value_t<Monad>>,
+                                    std::remove_cvref_t<detail::forward_value_t<Monads>>...>;
+         using error_t = detail::common_error_t<Monad, Monads...>;
+         using res_t = result<tuple_t, error_t>;
+
+         if (detail::all_ok(m, ms...))
+         {
+            return res_t(ok(tuple_t(detail::forward_value(std::forward<Monad>(m)),
+                                    detail::forward_value(std::forward<Monads>(ms))...)));
+         }
+
+         return res_t(err(detail::first_error<error_t>(std::forward<Monad>(m),
+                                                       std::forward<Monads>(ms)...)));
+      }
+   };
+
+   /**
+    * @brief Combine two or more monads into a monad of a tuple of their values.
+    *
+    * May be called directly, as in 'zip(m1, m2)', or through a pipe, as in 'm1 | zip(m2)'.
+    */
+   const constexpr operation<zip_fn> zip = {};
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_OPERATIONS_ZIP_HPP
@@ -0,0 +1,233 @@
+/**
+ * @file parallel/algorithm.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the parallel versions of the operations over ranges of monads
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_PARALLEL_ALGORITHM_HPP
+#define LIBREGLISSE_PARALLEL_ALGORITHM_HPP
+
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/transform.hpp>
+#include <libreglisse/parallel/output_buffer.hpp>
+#include <libreglisse/parallel/thread_pool.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      /**
+       * @brief Construct 'make(i)' for every index of [0, count) into a new buffer, in parallel.
+       *
+       * If a construction throws, every constructed element is destroyed before the exception
+       * is rethrown.
+       */
+      template <typename T, typename Make>
+      auto parallel_construct(thread_pool& pool, std::size_t count, Make& make)
+         -> output_buffer<T>
+      {
+         output_buffer<T> res = output_buffer_access::allocate<T>(count);
+         T* data = res.data();
+
+         [[maybe_unused]] std::mutex ledger_mutex;
+         [[maybe_unused]] std::vector<std::pair<std::size_t, std::size_t>> ledger;
+
+         auto body = [&](std::size_t begin, std::size_t end) {
+            std::size_t i = begin;
+
+#if defined(__cpp_exceptions)
+            try
+            {
+               for (; i < end; ++i)
+               {
+                  std::construct_at(data + i, make(i));
+               }
+            }
+            catch (...)
+            {
+               std::destroy(data + begin, data + i);
+               throw;
+            }
+
+            if constexpr (not std::is_nothrow_invocable_v<Make&, std::size_t>)
+            {
+               const std::lock_guard lock(ledger_mutex);
+               ledger.emplace_back(begin, end);
+            }
+#else
+            for (; i < end; ++i)
+            {
+               std::construct_at(data + i, make(i));
+            }
+#endif // defined(__cpp_exceptions)
+         };
+
+#if defined(__cpp_exceptions)
+         try
+         {
+            run_tuned(pool, count, body);
+         }
+         catch (...)
+         {
+            for (const auto& [begin, end] : ledger)
+            {
+               std::destroy(data + begin, data + end);
+            }
+
+            throw;
+         }
+#else
+         run_tuned(pool, count, body);
+#endif // defined(__cpp_exceptions)
+
+         output_buffer_access::commit(res, count);
+
+         return res;
+      }
+
+      template <typename Range>
+      concept parallel_input_range =
+         std::ranges::random_access_range<Range> and std::ranges::sized_range<Range>;
+   } // namespace detail
+
+   /**
+    * @brief Apply the 'transform' operation to every monad of 'input' using the threads of
+    * 'pool'.
+    *
+    * The results are stored in the same order as the input. 'func' is called concurrently from
+    * multiple threads.
+    *
+    * @param [in] pool The pool running the loop.
+    * @param [in] input A random access range of monads.
+    * @param [in] func The function passed to 'transform'.
+    *
+    * @return A buffer holding the transformed monads.
+    */
+   template <detail::parallel_input_range Range, typename Func>
+      requires std::invocable<const transform_fn&, std::ranges::range_reference_t<Range>, Func&>
+   auto par_transform(thread_pool& pool, Range&& input, Func func)
+   {
+      using res_t = std::invoke_result_t<const transform_fn&,
+                                         std::ranges::range_reference_t<Range>, Func&>;
+
+      auto first = std::ranges::begin(input);
+      auto make = [&](std::size_t i) {
+         return transform(first[static_cast<std::ranges::range_difference_t<Range>>(i)], func);
+      };
+
+      return detail::parallel_construct<res_t>(pool, std::ranges::size(input), make);
+   }
+   /**
+    * @brief Apply the 'transform' operation to every monad of 'input' using the default pool.
+    */
+   template <detail::parallel_input_range Range, typename Func>
+      requires std::invocable<const transform_fn&, std::ranges::range_reference_t<Range>, Func&>
+   auto par_transform(Range&& input, Func func)
+   {
+      return par_transform(default_thread_pool(), std::forward<Range>(input), std::move(func));
+   }
+   /**
+    * @brief Apply the 'transform' operation to every monad of 'input' using the threads of
+    * 'pool', assigning the results to the matching elements of 'output'.
+    *
+    * @param [in] pool The pool running the loop.
+    * @param [in] input A random access range of monads.
+    * @param [out] output A random access range at least as large as 'input'.
+    * @param [in] func The function passed to 'transform'.
+    */
+   template <detail::parallel_input_range Range, std::ranges::random_access_range Output,
+             typename Func>
+      requires std::invocable<const transform_fn&, std::ranges::range_reference_t<Range>, Func&>
+   void par_transform(thread_pool& pool, Range&& input, Output&& output, Func func)
+   {
+      auto first = std::ranges::begin(input);
+      auto out = std::ranges::begin(output);
+
+      auto body = [&](std::size_t begin, std::size_t end) {
+         for (auto i = static_cast<std::ranges::range_difference_t<Range>>(begin);
+              i < static_cast<std::ranges::range_difference_t<Range>>(end); ++i)
+         {
+            out[i] = transform(first[i], func);
+         }
+      };
+
+      detail::run_tuned(pool, std::ranges::size(input), body);
+   }
+
+   /**
+    * @brief Apply the 'and_then' operation to every monad of 'input' using the threads of
+    * 'pool'.
+    *
+    * The results are stored in the same order as the input. 'func' is called concurrently from
+    * multiple threads.
+    *
+    * @param [in] pool The pool running the loop.
+    * @param [in] input A random access range of monads.
+    * @param [in] func The function passed to 'and_then'.
+    *
+    * @return A buffer holding the resulting monads.
+    */
+   template <detail::parallel_input_range Range, typename Func>
+      requires std::invocable<const and_then_fn&, std::ranges::range_reference_t<Range>, Func&>
+   auto par_and_then(thread_pool& pool, Range&& input, Func func)
+   {
+      using res_t = std::invoke_result_t<const and_then_fn&,
+                                         std::ranges::range_reference_t<Range>, Func&>;
+
+      auto first = std::ranges::begin(input);
+      auto make = [&](std::size_t i) {
+         return and_then(first[static_cast<std::ranges::range_difference_t<Range>>(i)], func);
+      };
+
+      return detail::parallel_construct<res_t>(pool, std::ranges::size(input), make);
+   }
+   /**
+    * @brief Apply the 'and_then' operation to every monad of 'input' using the default pool.
+    */
+   template <detail::parallel_input_range Range, typename Func>
+      requires std::invocable<const and_then_fn&, std::ranges::range_reference_t<Range>, Func&>
+   auto par_and_then(Range&& input, Func func)
+   {
+      return par_and_then(default_thread_pool(), std::forward<Range>(input), std::move(func));
+   }
+   /**
+    * @brief Apply the 'and_then' operation to every monad of 'input' using the threads of
+    * 'pool', assigning the results to the matching elements of 'output'.
+    *
+    * @param [in] pool The pool running the loop.
+    * @param [in] input A random access range of monads.
+    * @param [out] output A random access range at least as large as 'input'.
+    * @param [in] func The function passed to 'and_then'.
+    */
+   template <detail::parallel_input_range Range, std::ranges::random_access_range Output,
+             typename Func>
+      requires std::invocable<const and_then_fn&, std::ranges::range_reference_t<Range>, Func&>
+   void par_and_then(thread_pool& pool, Range&& input, Output&& output, Func func)
+   {
+      auto first = std::ranges::begin(input);
+      auto out = std::ranges::begin(output);
+
+      auto body = [&](std::size_t begin, std::size_t end) {
+         for (auto i = static_cast<std::ranges::range_difference_t<Range>>(begin);
+              i < static_cast<std::ranges::range_difference_t<Range>>(end); ++i)
+         {
+            out[i] = and_then(first[i], func);
+         }
+      };
+
+      detail::run_tuned(pool, std::ranges::size(input), body);
+   }
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_PARALLEL_ALGORITHM_HPP
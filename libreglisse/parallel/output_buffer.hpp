@@ -0,0 +1,143 @@
+/**
+ * @file parallel/output_buffer.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the buffer returned by the parallel algorithms
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_PARALLEL_OUTPUT_BUFFER_HPP
+#define LIBREGLISSE_PARALLEL_OUTPUT_BUFFER_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      struct output_buffer_access;
+   } // namespace detail
+
+   /**
+    * @brief A fixed size, heap allocated array filled by the parallel algorithms.
+    *
+    * Unlike a std::vector, the memory is never initialized before the elements are constructed
+    * by the threads of the pool. Operating systems place pages on the memory node of the thread
+    * that first writes to them, so each part of the buffer ends up close to the thread that
+    * produced it.
+    */
+   template <typename T>
+   class output_buffer
+   {
+   public:
+      using value_type = T;
+      using size_type = std::size_t;
+      using iterator = T*;
+      using const_iterator = const T*;
+
+   public:
+      constexpr output_buffer() noexcept = default;
+      output_buffer(const output_buffer&) = delete;
+      output_buffer(output_buffer&& other) noexcept :
+         m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0))
+      {}
+      ~output_buffer()
+      {
+         if (m_data)
+         {
+            std::destroy_n(m_data, m_size);
+            ::operator delete(static_cast<void*>(m_data), std::align_val_t{alignof(T)});
+         }
+      }
+
+      auto operator=(const output_buffer&) -> output_buffer& = delete;
+      auto operator=(output_buffer&& rhs) noexcept -> output_buffer&
+      {
+         output_buffer(std::move(rhs)).swap(*this);
+
+         return *this;
+      }
+
+      [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+      [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+
+      [[nodiscard]] auto data() noexcept -> T* { return m_data; }
+      [[nodiscard]] auto data() const noexcept -> const T* { return m_data; }
+
+      [[nodiscard]] auto begin() noexcept -> iterator { return m_data; }
+      [[nodiscard]] auto begin() const noexcept -> const_iterator { return m_data; }
+      [[nodiscard]] auto end() noexcept -> iterator { return m_data + m_size; }
+      [[nodiscard]] auto end() const noexcept -> const_iterator { return m_data + m_size; }
+
+      auto operator[](size_type index) noexcept -> T&
+      {
+         assert(index < m_size); // NOLINT
+
+         return m_data[index];
+      }
+      auto operator[](size_type index) const noexcept -> const T&
+      {
+         assert(index < m_size); // NOLINT
+
+         return m_data[index];
+      }
+
+      operator std::span<T>() noexcept { return {m_data, m_size}; }             // NOLINT
+      operator std::span<const T>() const noexcept { return {m_data, m_size}; } // NOLINT
+
+      void swap(output_buffer& other) noexcept
+      {
+         std::swap(m_data, other.m_data);
+         std::swap(m_size, other.m_size);
+      }
+
+   private:
+      T* m_data = nullptr;
+      size_type m_size = 0;
+
+      friend struct detail::output_buffer_access;
+   };
+
+   namespace detail
+   {
+      /**
+       * @brief Gives the parallel algorithms access to the uninitialized storage of a buffer.
+       */
+      struct output_buffer_access
+      {
+         /**
+          * @brief Allocate the storage of a buffer of 'count' elements without constructing
+          * them.
+          */
+         template <typename T>
+         static auto allocate(std::size_t count) -> output_buffer<T>
+         {
+            output_buffer<T> res;
+
+            if (count != 0)
+            {
+               res.m_data = static_cast<T*>(
+                  ::operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+            }
+
+            return res;
+         }
+
+         /**
+          * @brief Mark the first 'count' elements of the buffer as constructed.
+          */
+         template <typename T>
+         static void commit(output_buffer<T>& buffer, std::size_t count) noexcept
+         {
+            buffer.m_size = count;
+         }
+      };
+   } // namespace detail
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_PARALLEL_OUTPUT_BUFFER_HPP
@@ -0,0 +1,275 @@
+/**
+ * @file parallel/partition.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the algorithms splitting a range of results into values & errors
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_PARALLEL_PARTITION_HPP
+#define LIBREGLISSE_PARALLEL_PARTITION_HPP
+
+#include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
+#include <libreglisse/parallel/output_buffer.hpp>
+#include <libreglisse/parallel/thread_pool.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reglisse::inline v0
+{
+   /**
+    * @brief The values & the errors of a range of results, in the order of the range.
+    *
+    * Each error is paired with the index of the result it came from. The parallel partition
+    * stores them in 'output_buffer's instead of vectors.
+    */
+   template <typename T, typename E, typename Values = std::vector<T>,
+             typename Errors = std::vector<std::pair<std::size_t, E>>>
+   struct partitioned_results
+   {
+      Values values;
+      Errors errors;
+   };
+
+   namespace detail
+   {
+      template <typename Range>
+      concept result_range = std::ranges::input_range<Range> and
+         result_monad<std::ranges::range_value_t<Range>>;
+
+      template <typename Range>
+      using partitioned_results_t =
+         partitioned_results<typename std::ranges::range_value_t<Range>::value_type,
+                             typename std::ranges::range_value_t<Range>::error_type>;
+
+      template <typename Range, typename T = typename std::ranges::range_value_t<Range>::value_type,
+                typename E = typename std::ranges::range_value_t<Range>::error_type>
+      using parallel_partitioned_results_t =
+         partitioned_results<T, E, output_buffer<T>, output_buffer<std::pair<std::size_t, E>>>;
+
+      /**
+       * @brief Access an element of the range, moving from it if the range is an rvalue.
+       */
+      template <typename Range, typename Element>
+      constexpr auto forward_element(Element& element) -> decltype(auto)
+      {
+         if constexpr (std::is_lvalue_reference_v<Range>)
+         {
+            return (element);
+         }
+         else
+         {
+            return std::move(element);
+         }
+      }
+
+      /**
+       * @brief The smallest number of elements processed by a task of the parallel partition.
+       */
+      inline constexpr std::size_t min_partition_block_size = 4096;
+   } // namespace detail
+
+   /**
+    * @brief Split a range of results into its values & its errors in a single pass on the
+    * calling thread.
+    *
+    * The elements are moved from if the range is an rvalue.
+    *
+    * @param [in] input The range of results.
+    *
+    * @return The values & the indexed errors, in the order of the range.
+    */
+   template <detail::result_range Range>
+   auto partition_results(Range&& input) -> detail::partitioned_results_t<Range>
+   {
+      detail::partitioned_results_t<Range> res;
+
+      if constexpr (std::ranges::sized_range<Range>)
+      {
+         res.values.reserve(std::ranges::size(input));
+      }
+
+      std::size_t index = 0;
+      for (auto&& element : input)
+      {
+         if (element.is_ok())
+         {
+            res.values.emplace_back(
+               detail::forward_value(detail::forward_element<Range>(element)));
+         }
+         else
+         {
+            res.errors.emplace_back(
+               index, detail::forward_error(detail::forward_element<Range>(element)));
+         }
+
+         ++index;
+      }
+
+      return res;
+   }
+
+   /**
+    * @brief Split a range of results into its values & its errors using the threads of 'pool'.
+    *
+    * The range is cut into blocks. A first parallel pass counts the values of every block, a
+    * prefix sum of the counts gives each block its offset in the outputs, and a second parallel
+    * pass constructs every value & error at its final position without any locking. The outputs
+    * are stored in 'output_buffer's, whose memory is first written by the thread producing it,
+    * and hold the same elements as the ones of the single threaded overload. Ranges of a single
+    * block are partitioned on the calling thread.
+    *
+    * If constructing an output throws, every output constructed is destroyed before the
+    * exception is rethrown.
+    *
+    * @param [in] pool The pool running the passes.
+    * @param [in] input A random access range of results.
+    *
+    * @return The values & the indexed errors, in the order of the range.
+    */
+   template <detail::result_range Range>
+      requires std::ranges::random_access_range<Range> and std::ranges::sized_range<Range>
+   auto partition_results(thread_pool& pool, Range&& input)
+      -> detail::parallel_partitioned_results_t<Range>
+   {
+      using results_t = detail::parallel_partitioned_results_t<Range>;
+      using value_t = typename std::ranges::range_value_t<Range>::value_type;
+      using error_t = typename decltype(results_t::errors)::value_type;
+
+      const std::size_t count = std::ranges::size(input);
+      const std::size_t block_size = std::max(detail::min_partition_block_size,
+                                              (count + pool.concurrency() * 8 - 1) /
+                                                 (pool.concurrency() * 8));
+
+      const std::size_t block_count = (count + block_size - 1) / block_size;
+      auto first = std::ranges::begin(input);
+
+      auto element = [&](std::size_t i) -> decltype(auto) {
+         return first[static_cast<std::ranges::range_difference_t<Range>>(i)];
+      };
+
+      std::vector<std::size_t> value_offsets(block_count + 1, 0);
+
+      pool.for_each_chunk(block_count, 1, [&](std::size_t block_begin, std::size_t block_end) {
+         for (std::size_t block = block_begin; block < block_end; ++block)
+         {
+            const std::size_t end = std::min((block + 1) * block_size, count);
+
+            std::size_t values = 0;
+            for (std::size_t i = block * block_size; i < end; ++i)
+            {
+               values += element(i).is_ok() ? 1 : 0;
+            }
+
+            value_offsets[block + 1] = values;
+         }
+      });
+
+      for (std::size_t block = 0; block < block_count; ++block)
+      {
+         value_offsets[block + 1] += value_offsets[block];
+      }
+
+      const std::size_t value_count = value_offsets.back();
+
+      results_t res{.values = detail::output_buffer_access::allocate<value_t>(value_count),
+                    .errors = detail::output_buffer_access::allocate<error_t>(count - value_count)};
+
+      value_t* values = res.values.data();
+      error_t* errors = res.errors.data();
+
+      // The outputs of a block are [value_offsets[block], value_offsets[block + 1]) in the values
+      // & [begin - value_offsets[block], end - value_offsets[block + 1]) in the errors
+      auto destroy_block = [&](std::size_t block, std::size_t value_end, std::size_t error_end) {
+         const std::size_t begin = block * block_size;
+
+         std::destroy(values + value_offsets[block], values + value_end);
+         std::destroy(errors + (begin - value_offsets[block]), errors + error_end);
+      };
+
+      [[maybe_unused]] std::vector<unsigned char> completed(block_count, 0);
+
+      auto scatter = [&](std::size_t block_begin, std::size_t block_end) {
+         for (std::size_t block = block_begin; block < block_end; ++block)
+         {
+            const std::size_t begin = block * block_size;
+            const std::size_t end = std::min(begin + block_size, count);
+
+            std::size_t value_index = value_offsets[block];
+            std::size_t error_index = begin - value_offsets[block];
+
+#if defined(__cpp_exceptions)
+            try
+            {
+#endif // defined(__cpp_exceptions)
+               for (std::size_t i = begin; i < end; ++i)
+               {
+                  auto&& current = element(i);
+
+                  if (current.is_ok())
+                  {
+                     std::construct_at(
+                        values + value_index,
+                        detail::forward_value(detail::forward_element<Range>(current)));
+                     ++value_index;
+                  }
+                  else
+                  {
+                     std::construct_at(
+                        errors + error_index, i,
+                        detail::forward_error(detail::forward_element<Range>(current)));
+                     ++error_index;
+                  }
+               }
+#if defined(__cpp_exceptions)
+            }
+            catch (...)
+            {
+               destroy_block(block, value_index, error_index);
+               throw;
+            }
+
+            completed[block] = 1;
+#endif // defined(__cpp_exceptions)
+         }
+      };
+
+#if defined(__cpp_exceptions)
+      try
+      {
+         pool.for_each_chunk(block_count, 1, scatter);
+      }
+      catch (...)
+      {
+         for (std::size_t block = 0; block < block_count; ++block)
+         {
+            if (completed[block] != 0)
+            {
+               const std::size_t end = std::min((block + 1) * block_size, count);
+
+               destroy_block(block, value_offsets[block + 1], end - value_offsets[block + 1]);
+            }
+         }
+
+         throw;
+      }
+#else
+      pool.for_each_chunk(block_count, 1, scatter);
+#endif // defined(__cpp_exceptions)
+
+      detail::output_buffer_access::commit(res.values, value_count);
+      detail::output_buffer_access::commit(res.errors, count - value_count);
+
+      return res;
+   }
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_PARALLEL_PARTITION_HPP
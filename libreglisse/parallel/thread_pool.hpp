@@ -0,0 +1,459 @@
+/**
+ * @file parallel/thread_pool.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the work-stealing thread pool used by the parallel algorithms
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_PARALLEL_THREAD_POOL_HPP
+#define LIBREGLISSE_PARALLEL_THREAD_POOL_HPP
+
+#include <libreglisse/detail/ring_buffer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      /**
+       * @brief Set while the current thread executes a chunk of a parallel loop. Parallel loops
+       * started from within a chunk are run serially.
+       */
+      inline thread_local bool in_parallel_region = false; // NOLINT
+
+      /**
+       * @brief A range of chunks [begin, end) packed in a single word so that it can be split
+       * atomically by its owner & by thieves.
+       */
+      constexpr auto pack_chunk_range(std::uint64_t begin, std::uint64_t end) noexcept
+         -> std::uint64_t
+      {
+         return (begin << 32U) | end;
+      }
+      constexpr auto chunk_range_begin(std::uint64_t range) noexcept -> std::uint64_t
+      {
+         return range >> 32U;
+      }
+      constexpr auto chunk_range_end(std::uint64_t range) noexcept -> std::uint64_t
+      {
+         return range & std::numeric_limits<std::uint32_t>::max();
+      }
+
+      /**
+       * @brief Grow the chunk size until the number of chunks fits in a packed chunk range.
+       */
+      constexpr auto clamp_chunk_size(std::size_t count, std::size_t chunk_size) noexcept
+         -> std::size_t
+      {
+         constexpr std::size_t max_chunks = std::numeric_limits<std::uint32_t>::max();
+
+         const std::size_t min_size = count / max_chunks + (count % max_chunks != 0 ? 1 : 0);
+
+         return std::max({chunk_size, min_size, std::size_t{1}});
+      }
+
+      /**
+       * @brief The number of elements processed serially to estimate the cost of an element.
+       */
+      inline constexpr std::size_t probe_size = 16;
+
+      /**
+       * @brief The targeted duration of a single chunk. Long enough to amortize the cost of
+       * claiming a chunk, short enough to balance the load between the threads.
+       */
+      inline constexpr std::chrono::nanoseconds target_chunk_duration{std::chrono::microseconds{
+         100}};
+
+      /**
+       * @brief Compute a chunk size from the time taken to process 'probe_count' elements.
+       *
+       * The chunk size is bounded so that every participant gets a few chunks to steal from.
+       */
+      constexpr auto tuned_chunk_size(std::chrono::nanoseconds elapsed, std::size_t probe_count,
+                                      std::size_t count, std::size_t participants) noexcept
+         -> std::size_t
+      {
+         const auto per_element = std::max<std::int64_t>(
+            elapsed.count() / static_cast<std::int64_t>(std::max(probe_count, std::size_t{1})),
+            1);
+         const auto from_cost =
+            static_cast<std::size_t>(std::max<std::int64_t>(target_chunk_duration.count() /
+                                                               per_element,
+                                                            1));
+         const std::size_t from_balance = std::max(count / (participants * 4), std::size_t{1});
+
+         return std::min(from_cost, from_balance);
+      }
+   } // namespace detail
+
+   /**
+    * @brief A pool of threads executing parallel loops by splitting them into chunks.
+    *
+    * Every participant, including the thread starting the loop, owns a contiguous range of
+    * chunks. It consumes chunks from the front of its own range & steals the back half of the
+    * largest remaining range once it runs out of work, so the initial distribution keeps each
+    * thread on a contiguous part of the data.
+    */
+   class thread_pool
+   {
+      struct job
+      {
+         void (*invoke)(void*, std::size_t, std::size_t);
+         void* func;
+         std::size_t count;
+         std::size_t chunk_size;
+
+         std::atomic<bool> cancelled{false};
+         std::mutex error_mutex{};
+         std::exception_ptr error{};
+      };
+
+      struct alignas(detail::cache_line_size) participant
+      {
+         std::atomic<std::uint64_t> range{0};
+      };
+
+   public:
+      /**
+       * @brief Construct a pool with one worker per hardware thread, minus the thread starting
+       * the loops.
+       */
+      thread_pool() : thread_pool(std::max(std::thread::hardware_concurrency(), 1U) - 1) {}
+      /**
+       * @brief Construct a pool with 'worker_count' threads on top of the thread starting the
+       * loops.
+       */
+      explicit thread_pool(std::size_t worker_count) :
+         m_participants(std::make_unique<participant[]>(worker_count + 1)),
+         m_participant_count(worker_count + 1)
+      {
+         m_workers.reserve(worker_count);
+         for (std::size_t i = 0; i < worker_count; ++i)
+         {
+            m_workers.emplace_back([this, i] {
+               worker_loop(i + 1);
+            });
+         }
+      }
+      thread_pool(const thread_pool&) = delete;
+      thread_pool(thread_pool&&) = delete;
+      ~thread_pool()
+      {
+         {
+            const std::lock_guard lock(m_mutex);
+            m_stop = true;
+         }
+
+         m_wake.notify_all();
+
+         for (auto& worker : m_workers)
+         {
+            worker.join();
+         }
+      }
+
+      auto operator=(const thread_pool&) -> thread_pool& = delete;
+      auto operator=(thread_pool&&) -> thread_pool& = delete;
+
+      /**
+       * @brief The number of threads taking part in a parallel loop, including the caller.
+       */
+      [[nodiscard]] auto concurrency() const noexcept -> std::size_t
+      {
+         return m_participant_count;
+      }
+
+      /**
+       * @brief Call 'func(begin, end)' on every chunk of 'chunk_size' elements of [0, count).
+       *
+       * The call returns once every chunk has been processed. If a call to 'func' throws, the
+       * remaining chunks are skipped & the first exception is rethrown. Loops started from
+       * within 'func' are run serially on the calling thread.
+       *
+       * @param [in] count The number of elements to process.
+       * @param [in] chunk_size The number of elements in a chunk.
+       * @param [in] func The function called concurrently on each chunk.
+       */
+      template <std::invocable<std::size_t, std::size_t> Func>
+      void for_each_chunk(std::size_t count, std::size_t chunk_size, Func&& func)
+      {
+         if (count == 0)
+         {
+            return;
+         }
+
+         chunk_size = detail::clamp_chunk_size(count, chunk_size);
+
+         const std::size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+         if (detail::in_parallel_region or m_workers.empty() or chunk_count == 1)
+         {
+            for (std::size_t begin = 0; begin < count; begin += chunk_size)
+            {
+               func(begin, std::min(begin + chunk_size, count));
+            }
+
+            return;
+         }
+
+         using func_t = std::remove_reference_t<Func>;
+
+         void* erased = const_cast<void*>(static_cast<const void*>(std::addressof(func))); // NOLINT
+
+         job current{.invoke =
+                        [](void* f, std::size_t begin, std::size_t end) {
+                           (*static_cast<func_t*>(f))(begin, end); // NOLINT
+                        },
+                     .func = erased,
+                     .count = count,
+                     .chunk_size = chunk_size};
+
+         const std::lock_guard submit_lock(m_submit_mutex);
+
+         for (std::size_t i = 0; i < m_participant_count; ++i)
+         {
+            const std::size_t begin = i * chunk_count / m_participant_count;
+            const std::size_t end = (i + 1) * chunk_count / m_participant_count;
+
+            m_participants[i].range.store(detail::pack_chunk_range(begin, end),
+                                          std::memory_order_relaxed);
+         }
+
+         {
+            const std::lock_guard lock(m_mutex);
+            m_job = &current;
+            ++m_generation;
+         }
+
+         m_wake.notify_all();
+
+         run(current, 0);
+
+         {
+            std::unique_lock lock(m_mutex);
+            m_job = nullptr;
+            m_idle.wait(lock, [this] {
+               return m_active == 0;
+            });
+         }
+
+         if (current.error)
+         {
+            std::rethrow_exception(current.error);
+         }
+      }
+
+   private:
+      void worker_loop(std::size_t self)
+      {
+         std::uint64_t seen = 0;
+
+         while (true)
+         {
+            job* current = nullptr;
+
+            {
+               std::unique_lock lock(m_mutex);
+               m_wake.wait(lock, [&] {
+                  return m_stop or m_generation != seen;
+               });
+
+               if (m_stop)
+               {
+                  return;
+               }
+
+               seen = m_generation;
+               current = m_job;
+
+               if (current == nullptr)
+               {
+                  continue;
+               }
+
+               ++m_active;
+            }
+
+            run(*current, self);
+
+            {
+               const std::lock_guard lock(m_mutex);
+               --m_active;
+            }
+
+            m_idle.notify_all();
+         }
+      }
+
+      void run(job& current, std::size_t self)
+      {
+         detail::in_parallel_region = true;
+
+         do
+         {
+            std::uint64_t range = m_participants[self].range.load(std::memory_order_acquire);
+            while (detail::chunk_range_begin(range) < detail::chunk_range_end(range))
+            {
+               const std::uint64_t chunk = detail::chunk_range_begin(range);
+               const std::uint64_t next =
+                  detail::pack_chunk_range(chunk + 1, detail::chunk_range_end(range));
+
+               if (m_participants[self].range.compare_exchange_weak(range, next,
+                                                                    std::memory_order_acq_rel))
+               {
+                  execute(current, chunk);
+                  range = m_participants[self].range.load(std::memory_order_acquire);
+               }
+            }
+         } while (steal(self));
+
+         detail::in_parallel_region = false;
+      }
+
+      auto steal(std::size_t self) -> bool
+      {
+         while (true)
+         {
+            std::size_t victim = self;
+            std::uint64_t victim_range = 0;
+            std::uint64_t largest = 0;
+
+            for (std::size_t i = 0; i < m_participant_count; ++i)
+            {
+               const std::uint64_t range = m_participants[i].range.load(std::memory_order_acquire);
+               const std::uint64_t begin = detail::chunk_range_begin(range);
+               const std::uint64_t end = detail::chunk_range_end(range);
+
+               if (i != self and begin < end and end - begin > largest)
+               {
+                  victim = i;
+                  victim_range = range;
+                  largest = end - begin;
+               }
+            }
+
+            if (victim == self)
+            {
+               return false;
+            }
+
+            const std::uint64_t begin = detail::chunk_range_begin(victim_range);
+            const std::uint64_t end = detail::chunk_range_end(victim_range);
+            const std::uint64_t middle = begin + (end - begin) / 2;
+
+            if (m_participants[victim].range.compare_exchange_strong(
+                   victim_range, detail::pack_chunk_range(begin, middle),
+                   std::memory_order_acq_rel))
+            {
+               m_participants[self].range.store(detail::pack_chunk_range(middle, end),
+                                                std::memory_order_release);
+
+               return true;
+            }
+         }
+      }
+
+      static void execute(job& current, std::uint64_t chunk)
+      {
+         if (current.cancelled.load(std::memory_order_relaxed))
+         {
+            return;
+         }
+
+         const std::size_t begin = static_cast<std::size_t>(chunk) * current.chunk_size;
+         const std::size_t end = std::min(begin + current.chunk_size, current.count);
+
+#if defined(__cpp_exceptions)
+         try
+         {
+            current.invoke(current.func, begin, end);
+         }
+         catch (...)
+         {
+            const std::lock_guard lock(current.error_mutex);
+
+            if (not current.error)
+            {
+               current.error = std::current_exception();
+            }
+
+            current.cancelled.store(true, std::memory_order_relaxed);
+         }
+#else
+         current.invoke(current.func, begin, end);
+#endif // defined(__cpp_exceptions)
+      }
+
+   private:
+      std::unique_ptr<participant[]> m_participants;
+      std::size_t m_participant_count;
+
+      std::vector<std::thread> m_workers;
+
+      std::mutex m_submit_mutex;
+
+      std::mutex m_mutex;
+      std::condition_variable m_wake;
+      std::condition_variable m_idle;
+      job* m_job = nullptr;
+      std::uint64_t m_generation = 0;
+      std::size_t m_active = 0;
+      bool m_stop = false;
+   };
+
+   /**
+    * @brief The pool used by the parallel algorithms when none is provided.
+    */
+   inline auto default_thread_pool() -> thread_pool&
+   {
+      static thread_pool pool;
+
+      return pool;
+   }
+
+   namespace detail
+   {
+      /**
+       * @brief Call 'body(begin, end)' over [0, count), picking the chunk size from the time
+       * taken by the first few elements, which are processed serially by the caller.
+       */
+      template <typename Body>
+      void run_tuned(thread_pool& pool, std::size_t count, Body& body)
+      {
+         const std::size_t probe = std::min(count, probe_size);
+
+         const auto start = std::chrono::steady_clock::now();
+         body(std::size_t{0}, probe);
+         const auto elapsed = std::chrono::steady_clock::now() - start;
+
+         const std::size_t rest = count - probe;
+         if (rest == 0)
+         {
+            return;
+         }
+
+         const std::size_t chunk_size = tuned_chunk_size(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed), probe, rest,
+            pool.concurrency());
+
+         pool.for_each_chunk(rest, chunk_size, [&](std::size_t begin, std::size_t end) {
+            body(probe + begin, probe + end);
+         });
+      }
+   } // namespace detail
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_PARALLEL_THREAD_POOL_HPP
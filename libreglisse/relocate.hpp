@@ -0,0 +1,165 @@
+/**
+ * @file relocate.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the trivial relocation trait & the relocation helpers
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_RELOCATE_HPP
+#define LIBREGLISSE_RELOCATE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      template <typename... Types>
+      concept trivially_copy_constructible =
+         (std::is_trivially_copy_constructible_v<Types> and ...);
+
+      template <typename... Types>
+      concept trivially_move_constructible =
+         (std::is_trivially_move_constructible_v<Types> and ...);
+
+      template <typename... Types>
+      concept trivially_destructible = (std::is_trivially_destructible_v<Types> and ...);
+
+      template <typename... Types>
+      concept trivially_copy_assignable = trivially_copy_constructible<Types...> and
+         trivially_destructible<Types...> and (std::is_trivially_copy_assignable_v<Types> and ...);
+
+      template <typename... Types>
+      concept trivially_move_assignable = trivially_move_constructible<Types...> and
+         trivially_destructible<Types...> and (std::is_trivially_move_assignable_v<Types> and ...);
+   } // namespace detail
+
+   /**
+    * @brief Trait used to mark a type as trivially relocatable.
+    *
+    * A type is trivially relocatable if moving an object to a new address and destroying the
+    * original is equivalent to copying its bytes. Types that are trivially move constructible
+    * and trivially destructible are always trivially relocatable, other types may opt in by
+    * specializing this trait. The monadic types of the library are trivially relocatable when
+    * their payloads are.
+    */
+   template <typename T>
+   struct is_trivially_relocatable :
+      std::bool_constant<
+#if defined(__has_builtin)
+#   if __has_builtin(__is_trivially_relocatable)
+         __is_trivially_relocatable(T) or
+#   endif
+#endif
+         (std::is_trivially_move_constructible_v<T> and std::is_trivially_destructible_v<T>)>
+   {};
+
+   template <typename T>
+   inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+   template <typename T>
+   concept trivially_relocatable = is_trivially_relocatable_v<T>;
+
+   /**
+    * @brief Relocate the object pointed to by 'source' into the uninitialized storage pointed to
+    * by 'dest'.
+    *
+    * After this call, the lifetime of the object at 'source' has ended.
+    *
+    * @param [in] source The object to relocate.
+    * @param [in] dest Uninitialized storage for the relocated object.
+    *
+    * @return A pointer to the relocated object.
+    */
+   template <typename T>
+      requires(not std::is_const_v<T>)
+   constexpr auto relocate_at(T* source, T* dest) noexcept(
+      is_trivially_relocatable_v<T> or std::is_nothrow_move_constructible_v<T>) -> T*
+   {
+      if constexpr (is_trivially_relocatable_v<T>)
+      {
+         if (not std::is_constant_evaluated())
+         {
+            std::memmove(static_cast<void*>(dest), static_cast<const void*>(source), sizeof(T));
+
+            return std::launder(dest);
+         }
+      }
+
+      T* res = std::construct_at(dest, std::move(*source));
+      std::destroy_at(source);
+
+      return res;
+   }
+
+   /**
+    * @brief Relocate the object pointed to by 'source' into a prvalue.
+    *
+    * After this call, the lifetime of the object at 'source' has ended. The prvalue can only be
+    * built by a constructor, so the object is always moved & destroyed, even when it is trivially
+    * relocatable. Use 'relocate_at' to relocate it into storage with a memmove.
+    *
+    * @param [in] source The object to relocate.
+    *
+    * @return The relocated object.
+    */
+   template <typename T>
+      requires(not std::is_const_v<T>)
+   constexpr auto relocate(T* source) noexcept(std::is_nothrow_move_constructible_v<T>) -> T
+   {
+      T res = std::move(*source);
+      std::destroy_at(source);
+
+      return res;
+   }
+
+   /**
+    * @brief Relocate the objects in the range [first, last) into the uninitialized storage
+    * starting at 'dest'.
+    *
+    * Trivially relocatable types are relocated with a single memmove. The ranges may overlap
+    * only in the case of trivially relocatable types.
+    *
+    * @param [in] first The start of the range to relocate.
+    * @param [in] last The end of the range to relocate.
+    * @param [in] dest Uninitialized storage large enough to hold the relocated range.
+    *
+    * @return A pointer past the last relocated object.
+    */
+   template <typename T>
+      requires(not std::is_const_v<T>)
+   constexpr auto uninitialized_relocate(T* first, T* last, T* dest) noexcept(
+      is_trivially_relocatable_v<T> or std::is_nothrow_move_constructible_v<T>) -> T*
+   {
+      if constexpr (is_trivially_relocatable_v<T>)
+      {
+         if (not std::is_constant_evaluated())
+         {
+            const auto count = static_cast<std::size_t>(last - first);
+
+            if (count != 0)
+            {
+               std::memmove(static_cast<void*>(dest), static_cast<const void*>(first),
+                            count * sizeof(T));
+            }
+
+            return dest + count;
+         }
+      }
+
+      for (; first != last; ++first, ++dest)
+      {
+         relocate_at(first, dest);
+      }
+
+      return dest;
+   }
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_RELOCATE_HPP
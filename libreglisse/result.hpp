@@ -9,6 +9,9 @@
 #pragma once
 
 #include <libreglisse/concepts.hpp>
+#include <libreglisse/operations/pipe_closure.hpp>
+#include <libreglisse/ref.hpp>
+#include <libreglisse/relocate.hpp>
 
 #if defined(LIBREGLISSE_USE_EXCEPTIONS)
 #   include <libreglisse/detail/invalid_access_exception.hpp>
@@ -16,8 +19,17 @@
 #   include <cassert>
 #endif // defined (LIBREGLISSE_USE_EXCEPTIONS)
 
+#if defined(LIBREGLISSE_USE_INSTRUMENTATION)
+#   include <libreglisse/instrumentation.hpp>
+#endif // defined(LIBREGLISSE_USE_INSTRUMENTATION)
+
 #include <functional>
 #include <memory>
+#include <version>
+
+#if defined(__cpp_lib_expected)
+#   include <expected>
+#endif // defined(__cpp_lib_expected)
 
 namespace reglisse::inline v0
 {
@@ -148,12 +160,64 @@ namespace reglisse::inline v0
       constexpr result() = delete;
       constexpr result(ok<value_type>&& value) : m_is_ok(true)
       {
-         std::construct_at(&m_value, std::move(value).value()); // NOLINT
+         std::construct_at(&m_value, std::move(value.value())); // NOLINT
+      }
+#if defined(LIBREGLISSE_USE_INSTRUMENTATION)
+      constexpr result(err<error_type>&& error,
+                       std::source_location location = std::source_location::current()) :
+         m_is_ok(false)
+      {
+         std::construct_at(&m_error, std::move(error.value())); // NOLINT
+
+         if (not std::is_constant_evaluated())
+         {
+            detail::record_construction(call_site_kind::err, location);
+         }
       }
+#else
       constexpr result(err<error_type>&& error) : m_is_ok(false)
       {
-         std::construct_at(&m_error, std::move(error).value()); // NOLINT
+         std::construct_at(&m_error, std::move(error.value())); // NOLINT
       }
+#endif // defined(LIBREGLISSE_USE_INSTRUMENTATION)
+#if defined(__cpp_lib_expected)
+      /**
+       * @brief Construct from a std::expected, copying its value or its error.
+       */
+      explicit constexpr result(const std::expected<value_type, error_type>& other) :
+         m_is_ok(other.has_value())
+      {
+         if (is_ok())
+         {
+            std::construct_at(&m_value, *other); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_error, other.error()); // NOLINT
+         }
+      }
+      /**
+       * @brief Construct from a std::expected, moving its value or its error.
+       */
+      explicit constexpr result(std::expected<value_type, error_type>&& other) :
+         m_is_ok(other.has_value())
+      {
+         if (is_ok())
+         {
+            std::construct_at(&m_value, std::move(*other)); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_error, std::move(other).error()); // NOLINT
+         }
+      }
+#endif // defined(__cpp_lib_expected)
+      /**
+       * @brief Trivially copy construct a result.
+       */
+      constexpr result(const result&)
+         requires detail::trivially_copy_constructible<value_type, error_type>
+      = default;
       constexpr result(const result& other) : m_is_ok(other.m_is_ok)
       {
          if (is_ok())
@@ -165,17 +229,27 @@ namespace reglisse::inline v0
             std::construct_at(&m_error, other.borrow_err()); // NOLINT
          }
       }
+      /**
+       * @brief Trivially move construct a result.
+       */
+      constexpr result(result&&) noexcept
+         requires detail::trivially_move_constructible<value_type, error_type>
+      = default;
       constexpr result(result&& other) noexcept : m_is_ok(other.m_is_ok)
       {
          if (is_ok())
          {
-            std::construct_at(&m_value, std::move(other).take()); // NOLINT
+            std::construct_at(&m_value, std::move(other.m_value)); // NOLINT
          }
          else
          {
-            std::construct_at(&m_error, std::move(other).take_err()); // NOLINT
+            std::construct_at(&m_error, std::move(other.m_error)); // NOLINT
          }
       }
+      /**
+       * @brief Trivially destroy a result.
+       */
+      constexpr ~result() requires detail::trivially_destructible<value_type, error_type> = default;
       constexpr ~result()
       {
          if (is_ok())
@@ -188,55 +262,112 @@ namespace reglisse::inline v0
          }
       }
 
+      /**
+       * @brief Trivially copy assign a result.
+       */
+      constexpr auto operator=(const result&) -> result&
+         requires detail::trivially_copy_assignable<value_type, error_type>
+      = default;
+      /**
+       * @brief Copy assign a result.
+       *
+       * If both monads hold the same alternative, it is assigned in place to reuse its storage.
+       */
       constexpr auto operator=(const result& rhs) -> result&
       {
          if (this != &rhs)
          {
-            if (is_ok())
+            if (is_ok() && rhs.is_ok())
             {
-               std::destroy_at(&m_value); // NOLINT
+               if constexpr (std::is_copy_assignable_v<value_type>)
+               {
+                  m_value = rhs.m_value; // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_value);                // NOLINT
+                  std::construct_at(&m_value, rhs.m_value); // NOLINT
+               }
             }
-            else
+            else if (is_err() && rhs.is_err())
             {
-               std::destroy_at(&m_error); // NOLINT
+               if constexpr (std::is_copy_assignable_v<error_type>)
+               {
+                  m_error = rhs.m_error; // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_error);                // NOLINT
+                  std::construct_at(&m_error, rhs.m_error); // NOLINT
+               }
             }
-
-            m_is_ok = rhs.m_is_ok;
-
-            if (is_ok())
+            else if (rhs.is_ok())
             {
-               std::construct_at(&m_value, rhs.borrow()); // NOLINT
+               std::destroy_at(&m_error);                // NOLINT
+               std::construct_at(&m_value, rhs.m_value); // NOLINT
+               m_is_ok = true;
             }
             else
             {
-               std::construct_at(&m_error, rhs.borrow_err()); // NOLINT
+               std::destroy_at(&m_value);                // NOLINT
+               std::construct_at(&m_error, rhs.m_error); // NOLINT
+               m_is_ok = false;
             }
          }
 
          return *this;
       }
+      /**
+       * @brief Trivially move assign a result.
+       */
+      constexpr auto operator=(result&&) noexcept -> result&
+         requires detail::trivially_move_assignable<value_type, error_type>
+      = default;
+      /**
+       * @brief Move assign a result.
+       *
+       * If both monads hold the same alternative, it is move assigned in place to reuse its
+       * storage.
+       */
       constexpr auto operator=(result&& rhs) noexcept -> result&
       {
          if (this != &rhs)
          {
-            if (is_ok())
+            if (is_ok() && rhs.is_ok())
             {
-               std::destroy_at(&m_value); // NOLINT
+               if constexpr (std::is_move_assignable_v<value_type>)
+               {
+                  m_value = std::move(rhs.m_value); // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_value);                           // NOLINT
+                  std::construct_at(&m_value, std::move(rhs.m_value)); // NOLINT
+               }
             }
-            else
+            else if (is_err() && rhs.is_err())
             {
-               std::destroy_at(&m_error); // NOLINT
+               if constexpr (std::is_move_assignable_v<error_type>)
+               {
+                  m_error = std::move(rhs.m_error); // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_error);                           // NOLINT
+                  std::construct_at(&m_error, std::move(rhs.m_error)); // NOLINT
+               }
             }
-
-            m_is_ok = rhs.m_is_ok;
-
-            if (is_ok())
+            else if (rhs.is_ok())
             {
-               std::construct_at(&m_value, std::move(rhs).take()); // NOLINT
+               std::destroy_at(&m_error);                           // NOLINT
+               std::construct_at(&m_value, std::move(rhs.m_value)); // NOLINT
+               m_is_ok = true;
             }
             else
             {
-               std::construct_at(&m_error, std::move(rhs).take_err()); // NOLINT
+               std::destroy_at(&m_value);                           // NOLINT
+               std::construct_at(&m_error, std::move(rhs.m_error)); // NOLINT
+               m_is_ok = false;
             }
          }
 
@@ -335,6 +466,129 @@ namespace reglisse::inline v0
          return std::forward<U>(other);
       }
 
+#if defined(__cpp_lib_expected)
+      /**
+       * @brief Copy the monad into a std::expected.
+       */
+      [[nodiscard]] constexpr auto to_expected() const& -> std::expected<value_type, error_type>
+      {
+         using expected_type = std::expected<value_type, error_type>;
+
+         if (is_ok())
+         {
+            return expected_type(std::in_place, m_value); // NOLINT
+         }
+
+         return expected_type(std::unexpect, m_error); // NOLINT
+      }
+      /**
+       * @brief Move the monad into a std::expected, moving its payload once.
+       */
+      [[nodiscard]] constexpr auto to_expected() && -> std::expected<value_type, error_type>
+      {
+         using expected_type = std::expected<value_type, error_type>;
+
+         if (is_ok())
+         {
+            return expected_type(std::in_place, std::move(m_value)); // NOLINT
+         }
+
+         return expected_type(std::unexpect, std::move(m_error)); // NOLINT
+      }
+      /**
+       * @brief Borrow the payload stored in the monad through a std::expected holding references
+       * to it, for interfaces taking expected references.
+       */
+      [[nodiscard]] constexpr auto borrow_expected() const&
+         -> std::expected<const_ref<value_type>, const_ref<error_type>>
+      {
+         using expected_type = std::expected<const_ref<value_type>, const_ref<error_type>>;
+
+         if (is_ok())
+         {
+            return expected_type(std::in_place, std::cref(m_value)); // NOLINT
+         }
+
+         return expected_type(std::unexpect, std::cref(m_error)); // NOLINT
+      }
+      /**
+       * @brief Borrow the payload stored in the monad through a std::expected holding mutable
+       * references to it, for interfaces taking expected references.
+       */
+      [[nodiscard]] constexpr auto borrow_expected() &
+         -> std::expected<mut_ref<value_type>, mut_ref<error_type>>
+      {
+         using expected_type = std::expected<mut_ref<value_type>, mut_ref<error_type>>;
+
+         if (is_ok())
+         {
+            return expected_type(std::in_place, std::ref(m_value)); // NOLINT
+         }
+
+         return expected_type(std::unexpect, std::ref(m_error)); // NOLINT
+      }
+#endif // defined(__cpp_lib_expected)
+
+      /**
+       * @brief Call 'on_ok' with the value stored in the monad, or 'on_err' with its error.
+       *
+       * The discriminant is tested once and the payload is handed over without the checks done by
+       * 'borrow' & 'take'. The payload is moved into the function if the monad is an rvalue.
+       *
+       * @param [in] on_ok The function called with the value stored.
+       * @param [in] on_err The function called with the error stored.
+       *
+       * @returns The value returned by the function called, converted to the common type of both.
+       */
+      template <std::invocable<const value_type&> OnOk, std::invocable<const error_type&> OnErr>
+      constexpr auto match(OnOk&& on_ok, OnErr&& on_err) const&
+         -> std::common_type_t<std::invoke_result_t<OnOk, const value_type&>,
+                               std::invoke_result_t<OnErr, const error_type&>>
+      {
+         if (is_ok())
+         {
+            return std::invoke(std::forward<OnOk>(on_ok), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnErr>(on_err), m_error); // NOLINT
+      }
+      template <std::invocable<value_type&> OnOk, std::invocable<error_type&> OnErr>
+      constexpr auto match(OnOk&& on_ok, OnErr&& on_err) &
+         -> std::common_type_t<std::invoke_result_t<OnOk, value_type&>,
+                               std::invoke_result_t<OnErr, error_type&>>
+      {
+         if (is_ok())
+         {
+            return std::invoke(std::forward<OnOk>(on_ok), m_value); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnErr>(on_err), m_error); // NOLINT
+      }
+      template <std::invocable<const value_type&&> OnOk, std::invocable<const error_type&&> OnErr>
+      constexpr auto match(OnOk&& on_ok, OnErr&& on_err) const&&
+         -> std::common_type_t<std::invoke_result_t<OnOk, const value_type&&>,
+                               std::invoke_result_t<OnErr, const error_type&&>>
+      {
+         if (is_ok())
+         {
+            return std::invoke(std::forward<OnOk>(on_ok), std::move(m_value)); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnErr>(on_err), std::move(m_error)); // NOLINT
+      }
+      template <std::invocable<value_type&&> OnOk, std::invocable<error_type&&> OnErr>
+      constexpr auto match(OnOk&& on_ok, OnErr&& on_err) &&
+         -> std::common_type_t<std::invoke_result_t<OnOk, value_type&&>,
+                               std::invoke_result_t<OnErr, error_type&&>>
+      {
+         if (is_ok())
+         {
+            return std::invoke(std::forward<OnOk>(on_ok), std::move(m_value)); // NOLINT
+         }
+
+         return std::invoke(std::forward<OnErr>(on_err), std::move(m_error)); // NOLINT
+      }
+
       [[nodiscard]] constexpr auto is_ok() const noexcept -> bool { return m_is_ok; }
       [[nodiscard]] constexpr auto is_err() const noexcept -> bool { return not is_ok(); }
       constexpr explicit operator bool() const noexcept { return is_ok(); }
@@ -387,4 +641,35 @@ namespace reglisse::inline v0
 
       return false;
    }
+
+   /**
+    * @brief A result is trivially relocatable when its payloads are.
+    */
+   template <typename ValueType, typename ErrorType>
+   struct is_trivially_relocatable<result<ValueType, ErrorType>> :
+      std::bool_constant<is_trivially_relocatable_v<ValueType> and
+                         is_trivially_relocatable_v<ErrorType>>
+   {};
+
+#if defined(__cpp_lib_expected)
+   namespace detail
+   {
+      /**
+       * @brief Operations apply to a std::expected as to the result it converts to. Adopting an
+       * lvalue copies its payload, adopting an rvalue moves it.
+       */
+      template <typename T, typename E>
+      struct monad_adaptor<std::expected<T, E>>
+      {
+         static constexpr auto adopt(const std::expected<T, E>& value) -> result<T, E>
+         {
+            return result<T, E>(value);
+         }
+         static constexpr auto adopt(std::expected<T, E>&& value) -> result<T, E>
+         {
+            return result<T, E>(std::move(value));
+         }
+      };
+   } // namespace detail
+#endif // defined(__cpp_lib_expected)
 } // namespace reglisse::v0
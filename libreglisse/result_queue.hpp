@@ -0,0 +1,149 @@
+/**
+ * @file result_queue.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains bounded concurrent queues of results with a separate lane for errors
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_RESULT_QUEUE_HPP
+#define LIBREGLISSE_RESULT_QUEUE_HPP
+
+#include <libreglisse/detail/ring_buffer.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      /**
+       * @brief A bounded queue of results storing the values & the errors in two separate
+       * rings.
+       *
+       * The discriminant of the results is never stored: values are pushed into the value lane
+       * & errors into the error lane, tagged with the number of values pushed before them.
+       * Consumers may drain the values in batches and handle the errors out of band.
+       */
+      template <template <typename> class Ring, typename T, typename E>
+      class basic_result_queue
+      {
+      public:
+         using value_type = T;
+         using error_type = E;
+         using error_entry = std::pair<std::size_t, error_type>;
+
+      public:
+         /**
+          * @brief Construct a queue able to hold at least 'capacity' values & 'capacity' errors.
+          */
+         explicit basic_result_queue(std::size_t capacity) :
+            basic_result_queue(capacity, capacity)
+         {}
+         /**
+          * @brief Construct a queue able to hold at least 'capacity' values & 'error_capacity'
+          * errors.
+          *
+          * Both capacities are rounded up to the next power of two.
+          */
+         basic_result_queue(std::size_t capacity, std::size_t error_capacity) :
+            m_values(capacity), m_errors(error_capacity)
+         {}
+
+         /**
+          * @brief Push a result in the lane corresponding to its content.
+          *
+          * @param [in] res The result to push. Its content is only moved from on success.
+          *
+          * @return false if the corresponding lane was full.
+          */
+         auto try_push(result<value_type, error_type>& res) noexcept -> bool
+         {
+            if (res.is_ok())
+            {
+               return m_values.try_emplace(std::move(res.borrow()));
+            }
+
+            return m_errors.try_emplace(m_values.pushed(), std::move(res.borrow_err()));
+         }
+         /**
+          * @brief Push a result in the lane corresponding to its content.
+          *
+          * @param [in] res The result to push. Its content is only moved from on success.
+          *
+          * @return false if the corresponding lane was full.
+          */
+         auto try_push(result<value_type, error_type>&& res) noexcept -> bool
+         {
+            return try_push(res);
+         }
+
+         /**
+          * @brief Pop the value at the front of the value lane.
+          *
+          * @return The popped value or none if no value was available.
+          */
+         auto try_pop() noexcept -> maybe<value_type> { return m_values.try_pop(); }
+         /**
+          * @brief Move up to 'out.size()' values from the value lane into 'out'.
+          *
+          * @return The number of values popped.
+          */
+         auto pop_n(std::span<value_type> out) noexcept -> std::size_t
+         {
+            return m_values.pop_n(out);
+         }
+
+         /**
+          * @brief Pop the error at the front of the error lane.
+          *
+          * @return The popped error, paired with the number of values pushed before it, or
+          * none if no error was available.
+          */
+         auto try_pop_err() noexcept -> maybe<error_entry> { return m_errors.try_pop(); }
+         /**
+          * @brief Move up to 'out.size()' errors from the error lane into 'out'.
+          *
+          * @return The number of errors popped.
+          */
+         auto pop_n_err(std::span<error_entry> out) noexcept -> std::size_t
+         {
+            return m_errors.pop_n(out);
+         }
+
+         [[nodiscard]] auto capacity() const noexcept -> std::size_t
+         {
+            return m_values.capacity();
+         }
+         [[nodiscard]] auto error_capacity() const noexcept -> std::size_t
+         {
+            return m_errors.capacity();
+         }
+
+      private:
+         Ring<value_type> m_values;
+         Ring<error_entry> m_errors;
+      };
+   } // namespace detail
+
+   /**
+    * @brief A bounded lock-free queue of results with a single producer & a single consumer.
+    */
+   template <typename T, typename E>
+   using spsc_result_queue = detail::basic_result_queue<detail::spsc_ring, T, E>;
+
+   /**
+    * @brief A bounded lock-free queue of results with multiple producers & multiple consumers.
+    *
+    * The index paired with each error is a snapshot of the number of values claimed by the
+    * producers at the time the error was pushed.
+    */
+   template <typename T, typename E>
+   using mpmc_result_queue = detail::basic_result_queue<detail::mpmc_ring, T, E>;
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_RESULT_QUEUE_HPP
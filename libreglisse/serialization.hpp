@@ -0,0 +1,1299 @@
+/**
+ * @file serialization.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Contains the binary encoding of the monads, their zero-copy views & the bulk array
+ * encoding
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_SERIALIZATION_HPP
+#define LIBREGLISSE_SERIALIZATION_HPP
+
+#include <libreglisse/concepts.hpp>
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace reglisse::inline v0
+{
+   /**
+    * @brief The reasons a buffer may fail to decode.
+    */
+   enum struct decode_error : std::uint8_t
+   {
+      truncated,   ///< The buffer ends before the encoded value
+      invalid_tag, ///< A tag byte holds a value that names no alternative
+      corrupted    ///< The counts of an encoded array disagree with its bitmap
+   };
+
+   /**
+    * @brief Appends the bytes of encoded values to a vector.
+    */
+   class byte_writer
+   {
+   public:
+      explicit byte_writer(std::vector<std::byte>& out) : m_out(&out) {}
+
+      void write(const void* data, std::size_t size)
+      {
+         const std::size_t offset = std::size(*m_out);
+
+         m_out->resize(offset + size);
+         std::memcpy(m_out->data() + offset, data, size);
+      }
+      void write_tag(std::uint8_t tag) { m_out->push_back(static_cast<std::byte>(tag)); }
+      void pad_to(std::size_t alignment, std::size_t origin)
+      {
+         const std::size_t offset = std::size(*m_out) - origin;
+         m_out->resize(std::size(*m_out) + (alignment - offset % alignment) % alignment);
+      }
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t { return std::size(*m_out); }
+
+   private:
+      std::vector<std::byte>* m_out;
+   };
+
+   /**
+    * @brief Reads encoded values from a buffer, keeping track of the bytes consumed.
+    */
+   class byte_reader
+   {
+   public:
+      explicit constexpr byte_reader(std::span<const std::byte> in) noexcept : m_in(in) {}
+
+      [[nodiscard]] auto read(void* data, std::size_t size) noexcept -> bool
+      {
+         if (remaining() < size)
+         {
+            return false;
+         }
+
+         std::memcpy(data, m_in.data() + m_position, size);
+         m_position += size;
+
+         return true;
+      }
+      [[nodiscard]] auto read_tag() noexcept -> maybe<std::uint8_t>
+      {
+         if (remaining() < 1)
+         {
+            return none;
+         }
+
+         return some(static_cast<std::uint8_t>(m_in[m_position++]));
+      }
+      [[nodiscard]] auto skip(std::size_t size) noexcept -> bool
+      {
+         if (remaining() < size)
+         {
+            return false;
+         }
+
+         m_position += size;
+
+         return true;
+      }
+      [[nodiscard]] auto skip_padding(std::size_t alignment, std::size_t origin) noexcept -> bool
+      {
+         return skip((alignment - (m_position - origin) % alignment) % alignment);
+      }
+
+      [[nodiscard]] constexpr auto position() const noexcept -> std::size_t { return m_position; }
+      [[nodiscard]] constexpr auto remaining() const noexcept -> std::size_t
+      {
+         return std::size(m_in) - m_position;
+      }
+      [[nodiscard]] constexpr auto bytes() const noexcept -> std::span<const std::byte>
+      {
+         return m_in;
+      }
+
+   private:
+      std::span<const std::byte> m_in;
+      std::size_t m_position = 0;
+   };
+
+   /**
+    * @brief Encodes & decodes values of type 'T'. Specialize it to make a payload type
+    * serializable.
+    *
+    * A specialization provides 'static void encode(byte_writer&, const T&)' and
+    * 'static auto decode(byte_reader&) -> result<T, decode_error>'. Trivially copyable types are
+    * encoded as their bytes in host byte order, so the encoding is meant for processes sharing
+    * an architecture. Types declaring a 'process_local' member type, whose bytes mean nothing to
+    * another process, are not.
+    */
+   template <typename T>
+   struct serializer;
+
+   // clang-format off
+
+   template <typename T>
+   concept serializable = requires(byte_writer& writer, byte_reader& reader, const T& value)
+   {
+      serializer<T>::encode(writer, value);
+      { serializer<T>::decode(reader) } -> std::same_as<result<T, decode_error>>;
+   };
+
+   // clang-format on
+
+   namespace detail
+   {
+      // clang-format off
+
+      /**
+       * @brief Types only meaningful in the process that made them, such as ids into a process
+       * wide table, opt out of being encoded as their bytes by declaring a 'process_local' member
+       * type.
+       */
+      template <typename T>
+      concept process_local_payload = requires
+      {
+         typename T::process_local;
+      };
+
+      // clang-format on
+
+      template <typename T>
+      concept trivial_payload =
+         std::is_trivially_copyable_v<T> and not monad<T> and not process_local_payload<T>;
+
+      template <typename T>
+      auto load(const std::byte* data) noexcept -> T
+      {
+         T res;
+         std::memcpy(&res, data, sizeof(T));
+
+         return res;
+      }
+
+      constexpr auto bitmap_size(std::size_t count) noexcept -> std::size_t
+      {
+         return (count + 7) / 8; // NOLINT
+      }
+
+      inline auto test_bit(std::span<const std::byte> bitmap, std::size_t index) noexcept -> bool
+      {
+         return ((bitmap[index / 8] >> (index % 8)) & std::byte{1}) != std::byte{0}; // NOLINT
+      }
+
+      /**
+       * @brief Check that the bits of a bitmap past its 'count' first ones are clear.
+       */
+      inline auto trailing_bits_clear(std::span<const std::byte> bitmap,
+                                      std::size_t count) noexcept -> bool
+      {
+         if (count % 8 == 0)
+         {
+            return true;
+         }
+
+         const auto mask = static_cast<std::uint8_t>(0xFFU << (count % 8)); // NOLINT
+
+         return (static_cast<std::uint8_t>(bitmap[count / 8]) & mask) == 0;
+      }
+
+      /**
+       * @brief Count the bits set from 'first', a multiple of 8, up to 'index' in a bitmap.
+       */
+      inline auto rank(std::span<const std::byte> bitmap, std::size_t first,
+                       std::size_t index) noexcept -> std::size_t
+      {
+         std::size_t res = 0;
+
+         for (std::size_t i = first / 8; i < index / 8; ++i)
+         {
+            res += static_cast<std::size_t>(std::popcount(static_cast<std::uint8_t>(bitmap[i])));
+         }
+
+         if (index % 8 != 0)
+         {
+            const auto mask = static_cast<std::uint8_t>((1U << (index % 8)) - 1U); // NOLINT
+            const auto last = static_cast<std::uint8_t>(bitmap[index / 8]);
+
+            res += static_cast<std::size_t>(std::popcount(static_cast<std::uint8_t>(last & mask)));
+         }
+
+         return res;
+      }
+   } // namespace detail
+
+   template <detail::trivial_payload T>
+   struct serializer<T>
+   {
+      static void encode(byte_writer& writer, const T& value) { writer.write(&value, sizeof(T)); }
+      static auto decode(byte_reader& reader) -> result<T, decode_error>
+      {
+         T value;
+         if (not reader.read(&value, sizeof(T)))
+         {
+            return err(decode_error::truncated);
+         }
+
+         return ok(value);
+      }
+   };
+
+   /**
+    * @brief Strings are encoded as their length on 64 bits followed by their characters.
+    */
+   template <>
+   struct serializer<std::string>
+   {
+      static void encode(byte_writer& writer, const std::string& value)
+      {
+         const auto length = static_cast<std::uint64_t>(std::size(value));
+
+         writer.write(&length, sizeof(length));
+         writer.write(std::data(value), std::size(value));
+      }
+      static auto decode(byte_reader& reader) -> result<std::string, decode_error>
+      {
+         std::uint64_t length = 0;
+         if (not reader.read(&length, sizeof(length)) or reader.remaining() < length)
+         {
+            return err(decode_error::truncated);
+         }
+
+         std::string value(static_cast<std::size_t>(length), '\0');
+         static_cast<void>(reader.read(std::data(value), std::size(value)));
+
+         return ok(std::move(value));
+      }
+   };
+
+   /**
+    * @brief A maybe is encoded as a tag byte, 0 for none & 1 for some, followed by its value.
+    */
+   template <serializable T>
+   struct serializer<maybe<T>>
+   {
+      static void encode(byte_writer& writer, const maybe<T>& value)
+      {
+         writer.write_tag(value.is_some() ? 1 : 0);
+
+         if (value.is_some())
+         {
+            serializer<T>::encode(writer, value.borrow());
+         }
+      }
+      static auto decode(byte_reader& reader) -> result<maybe<T>, decode_error>
+      {
+         const maybe<std::uint8_t> tag = reader.read_tag();
+         if (tag.is_none())
+         {
+            return err(decode_error::truncated);
+         }
+
+         if (tag.borrow() == 0)
+         {
+            return ok(maybe<T>(none));
+         }
+
+         if (tag.borrow() != 1)
+         {
+            return err(decode_error::invalid_tag);
+         }
+
+         result<T, decode_error> value = serializer<T>::decode(reader);
+         if (value.is_err())
+         {
+            return err(std::move(value).take_err());
+         }
+
+         return ok(maybe<T>(some(std::move(value).take())));
+      }
+   };
+
+   /**
+    * @brief A result is encoded as a tag byte, 0 for an error & 1 for a value, followed by the
+    * payload.
+    */
+   template <serializable T, serializable E>
+   struct serializer<result<T, E>>
+   {
+      static void encode(byte_writer& writer, const result<T, E>& value)
+      {
+         writer.write_tag(value.is_ok() ? 1 : 0);
+
+         if (value.is_ok())
+         {
+            serializer<T>::encode(writer, value.borrow());
+         }
+         else
+         {
+            serializer<E>::encode(writer, value.borrow_err());
+         }
+      }
+      static auto decode(byte_reader& reader) -> result<result<T, E>, decode_error>
+      {
+         const maybe<std::uint8_t> tag = reader.read_tag();
+         if (tag.is_none())
+         {
+            return err(decode_error::truncated);
+         }
+
+         if (tag.borrow() == 1)
+         {
+            result<T, decode_error> value = serializer<T>::decode(reader);
+            if (value.is_err())
+            {
+               return err(std::move(value).take_err());
+            }
+
+            return ok(result<T, E>(ok(std::move(value).take())));
+         }
+
+         if (tag.borrow() == 0)
+         {
+            result<E, decode_error> error = serializer<E>::decode(reader);
+            if (error.is_err())
+            {
+               return err(std::move(error).take_err());
+            }
+
+            return ok(result<T, E>(err(std::move(error).take())));
+         }
+
+         return err(decode_error::invalid_tag);
+      }
+   };
+
+   /**
+    * @brief An either is encoded as a tag byte, 0 for left & 1 for right, followed by the payload.
+    */
+   template <serializable L, serializable R>
+   struct serializer<either<L, R>>
+   {
+      static void encode(byte_writer& writer, const either<L, R>& value)
+      {
+         writer.write_tag(value.is_left() ? 0 : 1);
+
+         if (value.is_left())
+         {
+            serializer<L>::encode(writer, value.borrow_left());
+         }
+         else
+         {
+            serializer<R>::encode(writer, value.borrow_right());
+         }
+      }
+      static auto decode(byte_reader& reader) -> result<either<L, R>, decode_error>
+      {
+         const maybe<std::uint8_t> tag = reader.read_tag();
+         if (tag.is_none())
+         {
+            return err(decode_error::truncated);
+         }
+
+         if (tag.borrow() == 0)
+         {
+            result<L, decode_error> value = serializer<L>::decode(reader);
+            if (value.is_err())
+            {
+               return err(std::move(value).take_err());
+            }
+
+            return ok(either<L, R>(left(std::move(value).take())));
+         }
+
+         if (tag.borrow() == 1)
+         {
+            result<R, decode_error> value = serializer<R>::decode(reader);
+            if (value.is_err())
+            {
+               return err(std::move(value).take_err());
+            }
+
+            return ok(either<L, R>(right(std::move(value).take())));
+         }
+
+         return err(decode_error::invalid_tag);
+      }
+   };
+
+   /**
+    * @brief Append the encoding of 'value' to 'out'.
+    */
+   template <serializable T>
+   void encode(std::vector<std::byte>& out, const T& value)
+   {
+      byte_writer writer(out);
+      serializer<T>::encode(writer, value);
+   }
+
+   /**
+    * @brief Decode a value of type 'T' from the start of 'in'.
+    */
+   template <serializable T>
+   auto decode(std::span<const std::byte> in) -> result<T, decode_error>
+   {
+      byte_reader reader(in);
+
+      return serializer<T>::decode(reader);
+   }
+
+   /**
+    * @brief A view over an encoded maybe of a trivially copyable payload, read in place.
+    */
+   template <detail::trivial_payload T>
+   class maybe_view
+   {
+   public:
+      using value_type = T;
+
+   public:
+      /**
+       * @brief Check that 'in' starts with an encoded maybe & view it.
+       */
+      static auto from(std::span<const std::byte> in)
+      {
+         using res_t = result<maybe_view, decode_error>;
+
+         if (std::empty(in))
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         const auto tag = static_cast<std::uint8_t>(in[0]);
+         if (tag > 1)
+         {
+            return res_t(err(decode_error::invalid_tag));
+         }
+
+         if (tag == 1 and std::size(in) < 1 + sizeof(T))
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         return res_t(ok(maybe_view(in.data())));
+      }
+
+      [[nodiscard]] auto is_some() const noexcept -> bool { return m_data[0] == std::byte{1}; }
+      [[nodiscard]] auto is_none() const noexcept -> bool { return not is_some(); }
+
+      /**
+       * @brief Load the value stored. The view must hold a value.
+       */
+      [[nodiscard]] auto value() const -> T
+      {
+         detail::handle_invalid_maybe_access(is_some());
+
+         return detail::load<T>(m_data + 1);
+      }
+      [[nodiscard]] auto to_maybe() const -> maybe<T>
+      {
+         if (is_some())
+         {
+            return some(value());
+         }
+
+         return none;
+      }
+
+      /**
+       * @brief Get the number of bytes of the encoded maybe.
+       */
+      [[nodiscard]] auto encoded_size() const noexcept -> std::size_t
+      {
+         return is_some() ? 1 + sizeof(T) : 1;
+      }
+
+   private:
+      explicit maybe_view(const std::byte* data) noexcept : m_data(data) {}
+
+   private:
+      const std::byte* m_data;
+   };
+
+   /**
+    * @brief A view over an encoded result of trivially copyable payloads, read in place.
+    */
+   template <detail::trivial_payload T, detail::trivial_payload E>
+   class result_view
+   {
+   public:
+      using value_type = T;
+      using error_type = E;
+
+   public:
+      /**
+       * @brief Check that 'in' starts with an encoded result & view it.
+       */
+      static auto from(std::span<const std::byte> in)
+      {
+         using res_t = result<result_view, decode_error>;
+
+         if (std::empty(in))
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         const auto tag = static_cast<std::uint8_t>(in[0]);
+         if (tag > 1)
+         {
+            return res_t(err(decode_error::invalid_tag));
+         }
+
+         if (std::size(in) < 1 + (tag == 1 ? sizeof(T) : sizeof(E)))
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         return res_t(ok(result_view(in.data())));
+      }
+
+      [[nodiscard]] auto is_ok() const noexcept -> bool { return m_data[0] == std::byte{1}; }
+      [[nodiscard]] auto is_err() const noexcept -> bool { return not is_ok(); }
+
+      /**
+       * @brief Load the value stored. The view must hold a value.
+       */
+      [[nodiscard]] auto value() const -> T
+      {
+         detail::handle_invalid_value_result_access(is_ok());
+
+         return detail::load<T>(m_data + 1);
+      }
+      /**
+       * @brief Load the error stored. The view must hold an error.
+       */
+      [[nodiscard]] auto error() const -> E
+      {
+         detail::handle_invalid_error_result_access(is_err());
+
+         return detail::load<E>(m_data + 1);
+      }
+      [[nodiscard]] auto to_result() const -> result<T, E>
+      {
+         if (is_ok())
+         {
+            return ok(value());
+         }
+
+         return err(error());
+      }
+
+      /**
+       * @brief Get the number of bytes of the encoded result.
+       */
+      [[nodiscard]] auto encoded_size() const noexcept -> std::size_t
+      {
+         return 1 + (is_ok() ? sizeof(T) : sizeof(E));
+      }
+
+   private:
+      explicit result_view(const std::byte* data) noexcept : m_data(data) {}
+
+   private:
+      const std::byte* m_data;
+   };
+
+   /**
+    * @brief A view over an encoded either of trivially copyable payloads, read in place.
+    */
+   template <detail::trivial_payload L, detail::trivial_payload R>
+   class either_view
+   {
+   public:
+      using left_type = L;
+      using right_type = R;
+
+   public:
+      /**
+       * @brief Check that 'in' starts with an encoded either & view it.
+       */
+      static auto from(std::span<const std::byte> in)
+      {
+         using res_t = result<either_view, decode_error>;
+
+         if (std::empty(in))
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         const auto tag = static_cast<std::uint8_t>(in[0]);
+         if (tag > 1)
+         {
+            return res_t(err(decode_error::invalid_tag));
+         }
+
+         if (std::size(in) < 1 + (tag == 0 ? sizeof(L) : sizeof(R)))
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         return res_t(ok(either_view(in.data())));
+      }
+
+      [[nodiscard]] auto is_left() const noexcept -> bool { return m_data[0] == std::byte{0}; }
+      [[nodiscard]] auto is_right() const noexcept -> bool { return not is_left(); }
+
+      /**
+       * @brief Load the left value stored. The view must hold a left value.
+       */
+      [[nodiscard]] auto left_value() const -> L
+      {
+         detail::handle_invalid_left_either_access(is_left());
+
+         return detail::load<L>(m_data + 1);
+      }
+      /**
+       * @brief Load the right value stored. The view must hold a right value.
+       */
+      [[nodiscard]] auto right_value() const -> R
+      {
+         detail::handle_invalid_right_either_access(is_right());
+
+         return detail::load<R>(m_data + 1);
+      }
+      [[nodiscard]] auto to_either() const -> either<L, R>
+      {
+         if (is_left())
+         {
+            return left(left_value());
+         }
+
+         return right(right_value());
+      }
+
+      /**
+       * @brief Get the number of bytes of the encoded either.
+       */
+      [[nodiscard]] auto encoded_size() const noexcept -> std::size_t
+      {
+         return 1 + (is_left() ? sizeof(L) : sizeof(R));
+      }
+
+   private:
+      explicit either_view(const std::byte* data) noexcept : m_data(data) {}
+
+   private:
+      const std::byte* m_data;
+   };
+
+   /**
+    * @brief The alignment of the sections of an encoded array, relative to its start.
+    */
+   inline constexpr std::size_t array_section_alignment = 8;
+
+   /**
+    * @brief Encode an array of maybes as its length on 64 bits, a validity bitmap with the least
+    * significant bit first, then the values of every element. The slots of empty elements are
+    * zeroed so any element is found at a fixed offset. Sections are padded to
+    * 'array_section_alignment' bytes from the start of the array.
+    */
+   template <detail::trivial_payload T>
+   void encode_array(std::vector<std::byte>& out, std::span<const maybe<T>> values)
+   {
+      byte_writer writer(out);
+
+      const std::size_t origin = writer.size();
+      const auto count = static_cast<std::uint64_t>(std::size(values));
+
+      out.reserve(origin + sizeof(count) + detail::bitmap_size(std::size(values)) +
+                  array_section_alignment + std::size(values) * sizeof(T));
+
+      writer.write(&count, sizeof(count));
+
+      std::vector<std::byte> bitmap(detail::bitmap_size(std::size(values)));
+      for (std::size_t i = 0; i < std::size(values); ++i)
+      {
+         if (values[i].is_some())
+         {
+            bitmap[i / 8] |= std::byte{1} << (i % 8); // NOLINT
+         }
+      }
+
+      writer.write(bitmap.data(), std::size(bitmap));
+      writer.pad_to(array_section_alignment, origin);
+
+      const std::size_t first = writer.size();
+      out.resize(first + std::size(values) * sizeof(T));
+
+      for (std::size_t i = 0; i < std::size(values); ++i)
+      {
+         if (values[i].is_some())
+         {
+            std::memcpy(out.data() + first + i * sizeof(T), &values[i].borrow(), sizeof(T));
+         }
+      }
+   }
+
+   /**
+    * @brief Encode an array of results like an array of maybes holding their values, followed by
+    * the number of errors on 64 bits & the errors in order. Errors are expected to be rare, so
+    * they are stored densely rather than in a slot per element.
+    */
+   template <detail::trivial_payload T, detail::trivial_payload E>
+   void encode_array(std::vector<std::byte>& out, std::span<const result<T, E>> values)
+   {
+      byte_writer writer(out);
+
+      const std::size_t origin = writer.size();
+      const auto count = static_cast<std::uint64_t>(std::size(values));
+
+      writer.write(&count, sizeof(count));
+
+      std::vector<std::byte> bitmap(detail::bitmap_size(std::size(values)));
+      std::uint64_t error_count = 0;
+      for (std::size_t i = 0; i < std::size(values); ++i)
+      {
+         if (values[i].is_ok())
+         {
+            bitmap[i / 8] |= std::byte{1} << (i % 8); // NOLINT
+         }
+         else
+         {
+            ++error_count;
+         }
+      }
+
+      writer.write(bitmap.data(), std::size(bitmap));
+      writer.pad_to(array_section_alignment, origin);
+
+      const std::size_t first = writer.size();
+      out.resize(first + std::size(values) * sizeof(T));
+
+      for (std::size_t i = 0; i < std::size(values); ++i)
+      {
+         if (values[i].is_ok())
+         {
+            std::memcpy(out.data() + first + i * sizeof(T), &values[i].borrow(), sizeof(T));
+         }
+      }
+
+      writer.pad_to(array_section_alignment, origin);
+      writer.write(&error_count, sizeof(error_count));
+
+      for (const result<T, E>& value : values)
+      {
+         if (value.is_err())
+         {
+            writer.write(&value.borrow_err(), sizeof(E));
+         }
+      }
+   }
+
+   /**
+    * @brief The number of elements covered by each entry of a rank index.
+    */
+   inline constexpr std::size_t rank_block_size = 512;
+
+   /**
+    * @brief Encode the number of values before every block of 'rank_block_size' elements of an
+    * array of results, up to & including the block holding its end. Given to a
+    * 'result_array_view', it finds the error of an element without counting the whole bitmap.
+    */
+   template <typename T, typename E>
+   void encode_rank_index(std::vector<std::byte>& out, std::span<const result<T, E>> values)
+   {
+      byte_writer writer(out);
+
+      std::uint64_t ok_count = 0;
+      for (std::size_t i = 0; i <= std::size(values); ++i)
+      {
+         if (i % rank_block_size == 0)
+         {
+            writer.write(&ok_count, sizeof(ok_count));
+         }
+
+         if (i < std::size(values) and values[i].is_ok())
+         {
+            ++ok_count;
+         }
+      }
+   }
+
+   /**
+    * @brief A random access view over an array of maybes encoded by 'encode_array', read in
+    * place.
+    */
+   template <detail::trivial_payload T>
+   class maybe_array_view
+   {
+   public:
+      using value_type = T;
+
+      /**
+       * @brief A random access iterator loading the elements of the view by value.
+       */
+      class iterator
+      {
+      public:
+         using iterator_concept = std::random_access_iterator_tag;
+         using iterator_category = std::input_iterator_tag;
+         using value_type = maybe<T>;
+         using difference_type = std::ptrdiff_t;
+
+      public:
+         iterator() noexcept = default;
+
+         auto operator*() const -> maybe<T> { return (*m_view)[m_index]; }
+         auto operator[](difference_type n) const -> maybe<T> { return *(*this + n); }
+
+         auto operator++() noexcept -> iterator&
+         {
+            ++m_index;
+            return *this;
+         }
+         auto operator++(int) noexcept -> iterator
+         {
+            iterator res = *this;
+            ++*this;
+            return res;
+         }
+         auto operator--() noexcept -> iterator&
+         {
+            --m_index;
+            return *this;
+         }
+         auto operator--(int) noexcept -> iterator
+         {
+            iterator res = *this;
+            --*this;
+            return res;
+         }
+
+         auto operator+=(difference_type n) noexcept -> iterator&
+         {
+            m_index = static_cast<std::size_t>(static_cast<difference_type>(m_index) + n);
+            return *this;
+         }
+         auto operator-=(difference_type n) noexcept -> iterator& { return *this += -n; }
+
+         friend auto operator+(iterator it, difference_type n) noexcept -> iterator
+         {
+            return it += n;
+         }
+         friend auto operator+(difference_type n, iterator it) noexcept -> iterator
+         {
+            return it += n;
+         }
+         friend auto operator-(iterator it, difference_type n) noexcept -> iterator
+         {
+            return it -= n;
+         }
+         friend auto operator-(const iterator& lhs, const iterator& rhs) noexcept
+            -> difference_type
+         {
+            return static_cast<difference_type>(lhs.m_index) -
+               static_cast<difference_type>(rhs.m_index);
+         }
+
+         friend auto operator==(const iterator& lhs, const iterator& rhs) noexcept -> bool
+         {
+            return lhs.m_index == rhs.m_index;
+         }
+         friend auto operator<=>(const iterator& lhs, const iterator& rhs) noexcept
+         {
+            return lhs.m_index <=> rhs.m_index;
+         }
+
+      private:
+         iterator(const maybe_array_view* view, std::size_t index) noexcept :
+            m_view(view), m_index(index)
+         {}
+
+      private:
+         const maybe_array_view* m_view = nullptr;
+         std::size_t m_index = 0;
+
+         friend class maybe_array_view;
+      };
+
+   public:
+      /**
+       * @brief Check that 'in' starts with an encoded array of maybes & view it.
+       */
+      static auto from(std::span<const std::byte> in)
+      {
+         using res_t = result<maybe_array_view, decode_error>;
+
+         byte_reader reader(in);
+
+         std::uint64_t count = 0;
+         if (not reader.read(&count, sizeof(count)) or
+             count / 8 + (count % 8 != 0 ? 1 : 0) > reader.remaining()) // NOLINT
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         const auto size = static_cast<std::size_t>(count);
+         const std::span<const std::byte> bitmap = in.subspan(reader.position(),
+                                                              detail::bitmap_size(size));
+
+         if (not reader.skip(std::size(bitmap)) or
+             not reader.skip_padding(array_section_alignment, 0) or
+             reader.remaining() / sizeof(T) < size)
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         if (not detail::trailing_bits_clear(bitmap, size))
+         {
+            return res_t(err(decode_error::corrupted));
+         }
+
+         const std::span<const std::byte> values = in.subspan(reader.position(), size * sizeof(T));
+
+         const std::size_t encoded_size = reader.position() + std::size(values);
+
+         return res_t(ok(maybe_array_view(size, bitmap, values, encoded_size)));
+      }
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+      [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+
+      [[nodiscard]] auto begin() const noexcept -> iterator { return iterator(this, 0); }
+      [[nodiscard]] auto end() const noexcept -> iterator { return iterator(this, m_size); }
+
+      [[nodiscard]] auto is_some(std::size_t index) const noexcept -> bool
+      {
+         return detail::test_bit(m_bitmap, index);
+      }
+      /**
+       * @brief Load the element at 'index', which must be less than 'size()'.
+       */
+      [[nodiscard]] auto operator[](std::size_t index) const -> maybe<T>
+      {
+         if (is_some(index))
+         {
+            return some(detail::load<T>(m_values.data() + index * sizeof(T)));
+         }
+
+         return none;
+      }
+
+      /**
+       * @brief Get the number of bytes of the encoded array.
+       */
+      [[nodiscard]] auto encoded_size() const noexcept -> std::size_t { return m_encoded_size; }
+
+   private:
+      maybe_array_view(std::size_t size, std::span<const std::byte> bitmap,
+                       std::span<const std::byte> values, std::size_t encoded_size) noexcept :
+         m_size(size), m_bitmap(bitmap), m_values(values), m_encoded_size(encoded_size)
+      {}
+
+   private:
+      std::size_t m_size;
+      std::span<const std::byte> m_bitmap;
+      std::span<const std::byte> m_values;
+      std::size_t m_encoded_size;
+   };
+
+   /**
+    * @brief A random access view over an array of results encoded by 'encode_array', read in
+    * place. Finding the error of an element counts the values before it in the bitmap, from the
+    * start of the array or, when given a rank index, from the start of its block. Iterating
+    * keeps the count as it goes.
+    */
+   template <detail::trivial_payload T, detail::trivial_payload E>
+   class result_array_view
+   {
+   public:
+      using value_type = T;
+      using error_type = E;
+
+      /**
+       * @brief A random access iterator loading the elements of the view by value.
+       */
+      class iterator
+      {
+      public:
+         using iterator_concept = std::random_access_iterator_tag;
+         using iterator_category = std::input_iterator_tag;
+         using value_type = result<T, E>;
+         using difference_type = std::ptrdiff_t;
+
+      public:
+         iterator() noexcept = default;
+
+         auto operator*() const -> result<T, E> { return m_view->load(m_index, m_error_index); }
+         auto operator[](difference_type n) const -> result<T, E> { return *(*this + n); }
+
+         auto operator++() noexcept -> iterator&
+         {
+            if (not m_view->is_ok(m_index))
+            {
+               ++m_error_index;
+            }
+
+            ++m_index;
+            return *this;
+         }
+         auto operator++(int) noexcept -> iterator
+         {
+            iterator res = *this;
+            ++*this;
+            return res;
+         }
+         auto operator--() noexcept -> iterator&
+         {
+            --m_index;
+
+            if (not m_view->is_ok(m_index))
+            {
+               --m_error_index;
+            }
+
+            return *this;
+         }
+         auto operator--(int) noexcept -> iterator
+         {
+            iterator res = *this;
+            --*this;
+            return res;
+         }
+
+         auto operator+=(difference_type n) noexcept -> iterator&
+         {
+            m_index = static_cast<std::size_t>(static_cast<difference_type>(m_index) + n);
+            m_error_index = m_index - m_view->ok_rank(m_index);
+            return *this;
+         }
+         auto operator-=(difference_type n) noexcept -> iterator& { return *this += -n; }
+
+         friend auto operator+(iterator it, difference_type n) noexcept -> iterator
+         {
+            return it += n;
+         }
+         friend auto operator+(difference_type n, iterator it) noexcept -> iterator
+         {
+            return it += n;
+         }
+         friend auto operator-(iterator it, difference_type n) noexcept -> iterator
+         {
+            return it -= n;
+         }
+         friend auto operator-(const iterator& lhs, const iterator& rhs) noexcept
+            -> difference_type
+         {
+            return static_cast<difference_type>(lhs.m_index) -
+               static_cast<difference_type>(rhs.m_index);
+         }
+
+         friend auto operator==(const iterator& lhs, const iterator& rhs) noexcept -> bool
+         {
+            return lhs.m_index == rhs.m_index;
+         }
+         friend auto operator<=>(const iterator& lhs, const iterator& rhs) noexcept
+         {
+            return lhs.m_index <=> rhs.m_index;
+         }
+
+      private:
+         iterator(const result_array_view* view, std::size_t index,
+                  std::size_t error_index) noexcept :
+            m_view(view), m_index(index), m_error_index(error_index)
+         {}
+
+      private:
+         const result_array_view* m_view = nullptr;
+         std::size_t m_index = 0;
+         std::size_t m_error_index = 0;
+
+         friend class result_array_view;
+      };
+
+   public:
+      /**
+       * @brief Check that 'in' starts with an encoded array of results & view it. The number of
+       * errors it holds is checked against the bitmap, so that every error may be loaded.
+       */
+      static auto from(std::span<const std::byte> in)
+      {
+         using res_t = result<result_array_view, decode_error>;
+
+         byte_reader reader(in);
+
+         std::uint64_t count = 0;
+         if (not reader.read(&count, sizeof(count)) or
+             count / 8 + (count % 8 != 0 ? 1 : 0) > reader.remaining()) // NOLINT
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         const auto size = static_cast<std::size_t>(count);
+         const std::span<const std::byte> bitmap = in.subspan(reader.position(),
+                                                              detail::bitmap_size(size));
+
+         if (not reader.skip(std::size(bitmap)) or
+             not reader.skip_padding(array_section_alignment, 0) or
+             reader.remaining() / sizeof(T) < size)
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         if (not detail::trailing_bits_clear(bitmap, size))
+         {
+            return res_t(err(decode_error::corrupted));
+         }
+
+         const std::span<const std::byte> values = in.subspan(reader.position(), size * sizeof(T));
+
+         std::uint64_t error_count = 0;
+         if (not reader.skip(std::size(values)) or
+             not reader.skip_padding(array_section_alignment, 0) or
+             not reader.read(&error_count, sizeof(error_count)))
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         if (error_count != size - detail::rank(bitmap, 0, size))
+         {
+            return res_t(err(decode_error::corrupted));
+         }
+
+         if (reader.remaining() / sizeof(E) < error_count)
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         const auto errors = in.subspan(reader.position(),
+                                        static_cast<std::size_t>(error_count) * sizeof(E));
+
+         const std::size_t encoded_size = reader.position() + std::size(errors);
+
+         return res_t(ok(result_array_view(size, bitmap, values, errors, {}, encoded_size)));
+      }
+      /**
+       * @brief Check that 'in' starts with an encoded array of results & view it, finding errors
+       * through 'rank_index', encoded by 'encode_rank_index' for the same array. Every entry of
+       * the index is checked against the bitmap.
+       */
+      static auto from(std::span<const std::byte> in, std::span<const std::byte> rank_index)
+      {
+         using res_t = result<result_array_view, decode_error>;
+
+         auto res = from(in);
+         if (res.is_err())
+         {
+            return res;
+         }
+
+         if (std::size(rank_index) !=
+             (res.borrow().size() / rank_block_size + 1) * sizeof(std::uint64_t))
+         {
+            return res_t(err(decode_error::truncated));
+         }
+
+         const std::span<const std::byte> bitmap = res.borrow().m_bitmap;
+
+         std::uint64_t ok_count = 0;
+         for (std::size_t first = 0; first <= res.borrow().size(); first += rank_block_size)
+         {
+            if (first != 0)
+            {
+               ok_count += detail::rank(bitmap, first - rank_block_size, first);
+            }
+
+            const auto entry = detail::load<std::uint64_t>(
+               rank_index.data() + first / rank_block_size * sizeof(std::uint64_t));
+            if (entry != ok_count)
+            {
+               return res_t(err(decode_error::corrupted));
+            }
+         }
+
+         res.borrow().m_rank_index = rank_index;
+
+         return res;
+      }
+
+      [[nodiscard]] auto size() const noexcept -> std::size_t { return m_size; }
+      [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+      [[nodiscard]] auto error_count() const noexcept -> std::size_t
+      {
+         return std::size(m_errors) / sizeof(E);
+      }
+
+      [[nodiscard]] auto begin() const noexcept -> iterator { return iterator(this, 0, 0); }
+      [[nodiscard]] auto end() const noexcept -> iterator
+      {
+         return iterator(this, m_size, error_count());
+      }
+
+      [[nodiscard]] auto is_ok(std::size_t index) const noexcept -> bool
+      {
+         return detail::test_bit(m_bitmap, index);
+      }
+      /**
+       * @brief Load the element at 'index', which must be less than 'size()'.
+       */
+      [[nodiscard]] auto operator[](std::size_t index) const -> result<T, E>
+      {
+         if (is_ok(index))
+         {
+            return ok(detail::load<T>(m_values.data() + index * sizeof(T)));
+         }
+
+         return load(index, index - ok_rank(index));
+      }
+
+      /**
+       * @brief Get the number of bytes of the encoded array.
+       */
+      [[nodiscard]] auto encoded_size() const noexcept -> std::size_t { return m_encoded_size; }
+
+   private:
+      result_array_view(std::size_t size, std::span<const std::byte> bitmap,
+                        std::span<const std::byte> values, std::span<const std::byte> errors,
+                        std::span<const std::byte> rank_index, std::size_t encoded_size) noexcept :
+         m_size(size), m_bitmap(bitmap), m_values(values), m_errors(errors),
+         m_rank_index(rank_index), m_encoded_size(encoded_size)
+      {}
+
+      [[nodiscard]] auto ok_rank(std::size_t index) const noexcept -> std::size_t
+      {
+         if (std::empty(m_rank_index))
+         {
+            return detail::rank(m_bitmap, 0, index);
+         }
+
+         const std::size_t block = index / rank_block_size;
+         const auto before = detail::load<std::uint64_t>(m_rank_index.data() +
+                                                         block * sizeof(std::uint64_t));
+
+         return static_cast<std::size_t>(before) +
+            detail::rank(m_bitmap, block * rank_block_size, index);
+      }
+
+      [[nodiscard]] auto load(std::size_t index, std::size_t error_index) const -> result<T, E>
+      {
+         if (is_ok(index))
+         {
+            return ok(detail::load<T>(m_values.data() + index * sizeof(T)));
+         }
+
+         return err(detail::load<E>(m_errors.data() + error_index * sizeof(E)));
+      }
+
+   private:
+      std::size_t m_size;
+      std::span<const std::byte> m_bitmap;
+      std::span<const std::byte> m_values;
+      std::span<const std::byte> m_errors;
+      std::span<const std::byte> m_rank_index;
+      std::size_t m_encoded_size;
+   };
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_SERIALIZATION_HPP
@@ -0,0 +1,758 @@
+/**
+ * @file sum.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains everything related to the n-ary sum monad
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_SUM_HPP
+#define LIBREGLISSE_SUM_HPP
+
+#if defined(LIBREGLISSE_USE_EXCEPTIONS)
+#   include <libreglisse/detail/invalid_access_exception.hpp>
+#else
+#   include <cassert>
+#endif // defined (LIBREGLISSE_USE_EXCEPTIONS)
+
+#include <libreglisse/relocate.hpp>
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      inline void handle_invalid_sum_access(bool check)
+      {
+#if defined(LIBREGLISSE_USE_EXCEPTIONS)
+         if (!check)
+         {
+            throw invalid_access_exception("sum does not hold the requested alternative");
+         }
+#else
+         assert(check && "sum does not hold the requested alternative"); // NOLINT
+#endif // defined(LIBREGLISSE_USE_EXCEPTIONS)
+      }
+
+      /**
+       * @brief Tell the compiler that a branch is never taken.
+       */
+      [[noreturn]] inline void unreachable()
+      {
+#if defined(_MSC_VER) && !defined(__clang__)
+         __assume(false);
+#else
+         __builtin_unreachable();
+#endif
+      }
+
+      /**
+       * @brief The smallest unsigned integer able to index 'Count' alternatives.
+       */
+      template <std::size_t Count>
+      using sum_index_t =
+         std::conditional_t<(Count <= std::numeric_limits<std::uint8_t>::max()), std::uint8_t,
+                            std::uint16_t>;
+
+      template <std::size_t Index>
+      using index_constant = std::integral_constant<std::size_t, Index>;
+
+      template <typename Ret, std::size_t Index, typename Visitor>
+      constexpr auto dispatch_thunk(Visitor&& visitor) -> Ret
+      {
+         return std::invoke(std::forward<Visitor>(visitor), index_constant<Index>());
+      }
+
+      template <typename Ret, typename Visitor, typename Indices>
+      struct dispatch_table;
+
+      template <typename Ret, typename Visitor, std::size_t... Indices>
+      struct dispatch_table<Ret, Visitor, std::index_sequence<Indices...>>
+      {
+         static constexpr std::array<Ret (*)(Visitor&&), sizeof...(Indices)> value = {
+            &dispatch_thunk<Ret, Indices, Visitor>...};
+      };
+
+      template <typename Ret, std::size_t Index, std::size_t Count, typename Visitor>
+      constexpr auto dispatch_case(Visitor&& visitor) -> Ret
+      {
+         if constexpr (Index < Count)
+         {
+            return std::invoke(std::forward<Visitor>(visitor), index_constant<Index>());
+         }
+         else
+         {
+            unreachable();
+         }
+      }
+
+      /**
+       * @brief Call 'visitor' with 'index_constant<index>'.
+       *
+       * Up to eight alternatives are dispatched through a switch, which compilers lower to a
+       * jump table or a few comparisons. Larger sums index a constant table of function pointers.
+       * Every call is converted to the type returned for the first alternative.
+       */
+      template <std::size_t Count, typename Visitor>
+      constexpr auto dispatch(std::size_t index, Visitor&& visitor) -> decltype(auto)
+      {
+         using ret_t = std::invoke_result_t<Visitor, index_constant<0>>;
+
+         if constexpr (Count <= 8)
+         {
+            switch (index)
+            {
+               case 0:
+                  return dispatch_case<ret_t, 0, Count>(std::forward<Visitor>(visitor));
+               case 1:
+                  return dispatch_case<ret_t, 1, Count>(std::forward<Visitor>(visitor));
+               case 2:
+                  return dispatch_case<ret_t, 2, Count>(std::forward<Visitor>(visitor));
+               case 3:
+                  return dispatch_case<ret_t, 3, Count>(std::forward<Visitor>(visitor));
+               case 4:
+                  return dispatch_case<ret_t, 4, Count>(std::forward<Visitor>(visitor));
+               case 5:
+                  return dispatch_case<ret_t, 5, Count>(std::forward<Visitor>(visitor));
+               case 6:
+                  return dispatch_case<ret_t, 6, Count>(std::forward<Visitor>(visitor));
+               case 7:
+                  return dispatch_case<ret_t, 7, Count>(std::forward<Visitor>(visitor));
+               default:
+                  unreachable();
+            }
+         }
+         else
+         {
+            using table_t = dispatch_table<ret_t, Visitor, std::make_index_sequence<Count>>;
+
+            return table_t::value[index](std::forward<Visitor>(visitor)); // NOLINT
+         }
+      }
+
+      /**
+       * @brief Flat storage for the alternatives of a sum. Only one member is alive at a time, it
+       * is managed by the owning sum.
+       */
+      template <typename... Types>
+      union sum_storage;
+
+      template <>
+      union sum_storage<>
+      {
+      };
+
+      template <typename Type, typename... Types>
+      union sum_storage<Type, Types...>
+      {
+         constexpr sum_storage() noexcept : tail() {}
+
+         template <typename... Args>
+         constexpr sum_storage(std::in_place_index_t<0> /* index */, Args&&... args) :
+            head(std::forward<Args>(args)...)
+         {}
+         template <std::size_t Index, typename... Args>
+         constexpr sum_storage(std::in_place_index_t<Index> /* index */, Args&&... args) :
+            tail(std::in_place_index<Index - 1>, std::forward<Args>(args)...)
+         {}
+
+         constexpr sum_storage(const sum_storage&)
+            requires trivially_copy_constructible<Type, Types...>
+         = default;
+         constexpr sum_storage(sum_storage&&) noexcept
+            requires trivially_move_constructible<Type, Types...>
+         = default;
+
+         constexpr ~sum_storage() requires trivially_destructible<Type, Types...> = default;
+         constexpr ~sum_storage() {}
+
+         constexpr auto operator=(const sum_storage&) -> sum_storage&
+            requires trivially_copy_assignable<Type, Types...>
+         = default;
+         constexpr auto operator=(sum_storage&&) noexcept -> sum_storage&
+            requires trivially_move_assignable<Type, Types...>
+         = default;
+
+         Type head;
+         sum_storage<Types...> tail;
+      };
+
+      template <std::size_t Index, typename Storage>
+      constexpr auto get_alternative(Storage&& storage) noexcept -> auto&&
+      {
+         if constexpr (Index == 0)
+         {
+            return std::forward<Storage>(storage).head; // NOLINT
+         }
+         else
+         {
+            return get_alternative<Index - 1>(std::forward<Storage>(storage).tail); // NOLINT
+         }
+      }
+
+      template <typename Type, typename... Types>
+      inline constexpr std::size_t occurrences = (std::size_t{std::same_as<Type, Types>} + ... + 0);
+
+      template <typename Type, typename... Types>
+      concept unique_alternative = occurrences<Type, Types...> == 1;
+
+      template <typename Type, typename... Types>
+      inline constexpr std::size_t alternative_index = []() {
+         constexpr std::array<bool, sizeof...(Types)> matches = {std::same_as<Type, Types>...};
+
+         for (std::size_t i = 0; i < matches.size(); ++i)
+         {
+            if (matches[i]) // NOLINT
+            {
+               return i;
+            }
+         }
+
+         return matches.size();
+      }();
+
+      template <typename... Funcs>
+      struct overloaded : Funcs...
+      {
+         using Funcs::operator()...;
+      };
+
+      template <typename... Funcs>
+      overloaded(Funcs...) -> overloaded<Funcs...>;
+   } // namespace detail
+} // namespace reglisse::v0
+
+namespace reglisse::inline v0
+{
+   template <std::movable... Types>
+      requires(sizeof...(Types) >= 1) and (not(std::is_reference_v<Types> or ...))
+   class sum;
+
+   /**
+    * @brief Helper class to construct a sum monad holding its alternative at 'Index'
+    */
+   template <std::size_t Index, std::movable T>
+      requires(not std::is_reference_v<T>)
+   class alternative
+   {
+   public:
+      using value_type = T;
+
+      static constexpr std::size_t index = Index;
+
+   public:
+      /**
+       * @brief Construct by copying a value_type
+       *
+       * @param [in] value The value to be stored.
+       */
+      explicit constexpr alternative(const value_type& value) : m_value(value) {}
+      /**
+       * @brief Construct by moving a value_type.
+       *
+       * @param [in] value The value to move into the class.
+       */
+      explicit constexpr alternative(value_type&& value) : m_value(std::move(value)) {}
+
+      /**
+       * @brief Borrow the value stored within the class
+       *
+       * @return An immutable reference to the value stored within the class.
+       */
+      constexpr auto borrow() const& noexcept -> const value_type& { return m_value; }
+      /**
+       * @brief Borrow the value stored within the class
+       *
+       * @return A mutable reference to the value stored within the class.
+       */
+      constexpr auto borrow() & noexcept -> value_type& { return m_value; }
+      /**
+       * @brief Take the value stored within the class. This operation leaves the class in an
+       * undefined state.
+       *
+       * @return The value stored within the class
+       */
+      constexpr auto take() const&& noexcept -> const value_type { return std::move(m_value); }
+      /**
+       * @brief Take the value stored within the class. This operation leaves the class in an
+       * undefined state.
+       *
+       * @return The value stored within the class
+       */
+      constexpr auto take() && noexcept -> value_type { return std::move(m_value); }
+
+   private:
+      value_type m_value;
+   };
+
+   /**
+    * @brief Create the helper constructing a sum monad holding 'value' as its alternative at
+    * 'Index'. A 'const char*' param is stored as a std::string.
+    */
+   template <std::size_t Index, typename T>
+   constexpr auto at(T&& value)
+   {
+      using value_t = std::conditional_t<std::is_convertible_v<T, const char*>, std::string,
+                                         std::remove_cvref_t<T>>;
+
+      return alternative<Index, value_t>(value_t(std::forward<T>(value)));
+   }
+
+   /**
+    * @brief A monadic type that holds exactly one of its alternatives.
+    *
+    * Unlike nested eithers, the alternatives share a single flat storage and a single
+    * discriminant using the smallest unsigned integer able to index them. 'visit' and 'match'
+    * dispatch on the discriminant through a switch or a table of function pointers, so a call
+    * costs one indirect jump whatever the number of alternatives.
+    */
+   template <std::movable... Types>
+      requires(sizeof...(Types) >= 1) and (not(std::is_reference_v<Types> or ...))
+   class sum
+   {
+      static_assert(sizeof...(Types) <= std::numeric_limits<std::uint16_t>::max(),
+                    "too many alternatives for a sum");
+
+   public:
+      using index_type = detail::sum_index_t<sizeof...(Types)>; ///< Type of the discriminant
+
+      template <std::size_t Index>
+      using alternative_type = std::tuple_element_t<Index, std::tuple<Types...>>;
+
+      static constexpr std::size_t alternative_count = sizeof...(Types);
+
+   public:
+      constexpr sum() = delete;
+      /**
+       * @brief Construct from the helper class of one of the alternatives.
+       *
+       * @param [in] value Temporary value to store
+       */
+      template <std::size_t Index, typename U>
+         requires(Index < alternative_count) and
+         std::constructible_from<alternative_type<Index>, U&&>
+      constexpr sum(alternative<Index, U>&& value) :
+         m_storage(std::in_place_index<Index>, std::move(value).take()),
+         m_index(static_cast<index_type>(Index))
+      {}
+      /**
+       * @brief Construct from a value whose type appears exactly once among the alternatives.
+       *
+       * @param [in] value The value to store
+       */
+      template <typename U>
+         requires detail::unique_alternative<std::remove_cvref_t<U>, Types...>
+      constexpr sum(U&& value) :
+         m_storage(std::in_place_index<detail::alternative_index<std::remove_cvref_t<U>, Types...>>,
+                   std::forward<U>(value)),
+         m_index(static_cast<index_type>(
+            detail::alternative_index<std::remove_cvref_t<U>, Types...>))
+      {}
+      /**
+       * @brief Construct the alternative at 'Index' in place.
+       */
+      template <std::size_t Index, typename... Args>
+         requires(Index < alternative_count) and
+         std::constructible_from<alternative_type<Index>, Args...>
+      explicit constexpr sum(std::in_place_index_t<Index> index, Args&&... args) :
+         m_storage(index, std::forward<Args>(args)...), m_index(static_cast<index_type>(Index))
+      {}
+      /**
+       * @brief Trivially copy construct a sum.
+       */
+      constexpr sum(const sum&) requires detail::trivially_copy_constructible<Types...> = default;
+      /**
+       * @brief Copy construct a sum
+       */
+      constexpr sum(const sum& other) : m_index(other.m_index)
+      {
+         detail::dispatch<alternative_count>(
+            m_index, [&]<std::size_t I>(detail::index_constant<I>) {
+               std::construct_at(&detail::get_alternative<I>(m_storage),
+                                 detail::get_alternative<I>(other.m_storage));
+            });
+      }
+      /**
+       * @brief Trivially move construct a sum.
+       */
+      constexpr sum(sum&&) noexcept requires detail::trivially_move_constructible<Types...>
+      = default;
+      /**
+       * @brief Move construct a sum
+       */
+      constexpr sum(sum&& other) noexcept((std::is_nothrow_move_constructible_v<Types> and ...)) :
+         m_index(other.m_index)
+      {
+         detail::dispatch<alternative_count>(
+            m_index, [&]<std::size_t I>(detail::index_constant<I>) {
+               std::construct_at(&detail::get_alternative<I>(m_storage),
+                                 std::move(detail::get_alternative<I>(other.m_storage)));
+            });
+      }
+      /**
+       * @brief Trivially destroy a sum.
+       */
+      constexpr ~sum() requires detail::trivially_destructible<Types...> = default;
+      /**
+       * @brief Destruct sum.
+       */
+      constexpr ~sum() { destroy(); }
+
+      /**
+       * @brief Trivially copy assign a sum.
+       */
+      constexpr auto operator=(const sum&) -> sum&
+         requires detail::trivially_copy_assignable<Types...>
+      = default;
+      /**
+       * @brief Copy assign a sum.
+       *
+       * If both monads hold the same alternative, it is assigned in place to reuse its storage.
+       * Otherwise the alternative of 'rhs' is copied before the held one is destroyed, so a
+       * throwing copy leaves the monad untouched.
+       */
+      constexpr auto operator=(const sum& rhs) -> sum&
+      {
+         if (this != &rhs)
+         {
+            detail::dispatch<alternative_count>(
+               rhs.m_index, [&]<std::size_t I>(detail::index_constant<I>) {
+                  auto& value = detail::get_alternative<I>(m_storage);
+                  const auto& other = detail::get_alternative<I>(rhs.m_storage);
+
+                  if constexpr (std::is_copy_assignable_v<alternative_type<I>>)
+                  {
+                     if (m_index == I)
+                     {
+                        value = other;
+                        return;
+                     }
+                  }
+
+                  replace<I>(other);
+               });
+         }
+
+         return *this;
+      }
+      /**
+       * @brief Trivially move assign a sum.
+       */
+      constexpr auto operator=(sum&&) noexcept -> sum&
+         requires detail::trivially_move_assignable<Types...>
+      = default;
+      /**
+       * @brief Move assign a sum.
+       *
+       * If both monads hold the same alternative, it is move assigned in place to reuse its
+       * storage. Otherwise the held alternative is replaced as in the copy assignment.
+       */
+      constexpr auto operator=(sum&& rhs) noexcept(
+         (std::is_nothrow_move_constructible_v<Types> and ...) and
+         (std::is_nothrow_move_assignable_v<Types> and ...)) -> sum&
+      {
+         if (this != &rhs)
+         {
+            detail::dispatch<alternative_count>(
+               rhs.m_index, [&]<std::size_t I>(detail::index_constant<I>) {
+                  auto& value = detail::get_alternative<I>(m_storage);
+                  auto& other = detail::get_alternative<I>(rhs.m_storage);
+
+                  if constexpr (std::is_move_assignable_v<alternative_type<I>>)
+                  {
+                     if (m_index == I)
+                     {
+                        value = std::move(other);
+                        return;
+                     }
+                  }
+
+                  replace<I>(std::move(other));
+               });
+         }
+
+         return *this;
+      }
+
+      /**
+       * @brief Borrow the alternative at 'Index'.
+       *
+       * If the monad does not hold that alternative, an assert will be thrown at debug time. If you
+       * wish to have runtime checking, defining the LIBREGLISSE_USE_EXCEPTIONS macro before
+       * including this file will turn all assertions into exceptions.
+       *
+       * @returns The value of the alternative at 'Index'.
+       */
+      template <std::size_t Index>
+         requires(Index < alternative_count)
+      constexpr auto borrow() const& noexcept -> const alternative_type<Index>&
+      {
+         detail::handle_invalid_sum_access(is<Index>());
+
+         return detail::get_alternative<Index>(m_storage);
+      }
+      /**
+       * @brief Borrow the alternative at 'Index'.
+       *
+       * If the monad does not hold that alternative, an assert will be thrown at debug time. If you
+       * wish to have runtime checking, defining the LIBREGLISSE_USE_EXCEPTIONS macro before
+       * including this file will turn all assertions into exceptions.
+       *
+       * @returns The value of the alternative at 'Index'.
+       */
+      template <std::size_t Index>
+         requires(Index < alternative_count)
+      constexpr auto borrow() & noexcept -> alternative_type<Index>&
+      {
+         detail::handle_invalid_sum_access(is<Index>());
+
+         return detail::get_alternative<Index>(m_storage);
+      }
+      /**
+       * @brief Take the alternative at 'Index'.
+       *
+       * This operation leaves the monad in an undefined state, it is not recommended to use it
+       * after this function being called.
+       *
+       * If the monad does not hold that alternative, an assert will be thrown at debug time. If you
+       * wish to have runtime checking, defining the LIBREGLISSE_USE_EXCEPTIONS macro before
+       * including this file will turn all assertions into exceptions.
+       *
+       * @returns The value of the alternative at 'Index'.
+       */
+      template <std::size_t Index>
+         requires(Index < alternative_count)
+      constexpr auto take() const&& noexcept -> const alternative_type<Index>
+      {
+         detail::handle_invalid_sum_access(is<Index>());
+
+         return std::move(detail::get_alternative<Index>(m_storage));
+      }
+      /**
+       * @brief Take the alternative at 'Index'.
+       *
+       * This operation leaves the monad in an undefined state, it is not recommended to use it
+       * after this function being called.
+       *
+       * If the monad does not hold that alternative, an assert will be thrown at debug time. If you
+       * wish to have runtime checking, defining the LIBREGLISSE_USE_EXCEPTIONS macro before
+       * including this file will turn all assertions into exceptions.
+       *
+       * @returns The value of the alternative at 'Index'.
+       */
+      template <std::size_t Index>
+         requires(Index < alternative_count)
+      constexpr auto take() && noexcept -> alternative_type<Index>
+      {
+         detail::handle_invalid_sum_access(is<Index>());
+
+         return std::move(detail::get_alternative<Index>(m_storage));
+      }
+
+      /**
+       * @brief Get the index of the alternative held by the monad.
+       */
+      [[nodiscard]] constexpr auto index() const noexcept -> std::size_t { return m_index; }
+      /**
+       * @brief Check if the monad holds its alternative at 'Index'.
+       */
+      template <std::size_t Index>
+         requires(Index < alternative_count)
+      [[nodiscard]] constexpr auto is() const noexcept -> bool
+      {
+         return m_index == Index;
+      }
+
+      /**
+       * @brief Call 'visitor' with the alternative held by the monad.
+       *
+       * Every call must return a type convertible to the one returned for the first alternative.
+       *
+       * @returns The value returned by 'visitor'.
+       */
+      template <typename Visitor>
+      constexpr auto visit(Visitor&& visitor) const& -> decltype(auto)
+      {
+         return visit_impl(*this, std::forward<Visitor>(visitor));
+      }
+      template <typename Visitor>
+      constexpr auto visit(Visitor&& visitor) & -> decltype(auto)
+      {
+         return visit_impl(*this, std::forward<Visitor>(visitor));
+      }
+      template <typename Visitor>
+      constexpr auto visit(Visitor&& visitor) const&& -> decltype(auto)
+      {
+         return visit_impl(std::move(*this), std::forward<Visitor>(visitor));
+      }
+      template <typename Visitor>
+      constexpr auto visit(Visitor&& visitor) && -> decltype(auto)
+      {
+         return visit_impl(std::move(*this), std::forward<Visitor>(visitor));
+      }
+
+      /**
+       * @brief Call the function of 'funcs' accepting the alternative held by the monad.
+       *
+       * The functions are combined into a single overload set, as in
+       * 'm.match([](int i) {...}, [](const std::string& s) {...})'.
+       *
+       * @returns The value returned by the selected function.
+       */
+      template <typename... Funcs>
+      constexpr auto match(Funcs&&... funcs) const& -> decltype(auto)
+      {
+         return visit_impl(*this, detail::overloaded{std::forward<Funcs>(funcs)...});
+      }
+      template <typename... Funcs>
+      constexpr auto match(Funcs&&... funcs) & -> decltype(auto)
+      {
+         return visit_impl(*this, detail::overloaded{std::forward<Funcs>(funcs)...});
+      }
+      template <typename... Funcs>
+      constexpr auto match(Funcs&&... funcs) const&& -> decltype(auto)
+      {
+         return visit_impl(std::move(*this), detail::overloaded{std::forward<Funcs>(funcs)...});
+      }
+      template <typename... Funcs>
+      constexpr auto match(Funcs&&... funcs) && -> decltype(auto)
+      {
+         return visit_impl(std::move(*this), detail::overloaded{std::forward<Funcs>(funcs)...});
+      }
+
+   private:
+      template <typename Self, typename Visitor>
+      static constexpr auto visit_impl(Self&& self, Visitor&& visitor) -> decltype(auto)
+      {
+         return detail::dispatch<alternative_count>(
+            self.m_index, [&]<std::size_t I>(detail::index_constant<I>) -> decltype(auto) {
+               return std::invoke(std::forward<Visitor>(visitor),
+                                  detail::get_alternative<I>(std::forward<Self>(self).m_storage));
+            });
+      }
+
+      constexpr void destroy() noexcept
+      {
+         if constexpr (not detail::trivially_destructible<Types...>)
+         {
+            detail::dispatch<alternative_count>(
+               m_index, [&]<std::size_t I>(detail::index_constant<I>) {
+                  std::destroy_at(&detail::get_alternative<I>(m_storage));
+               });
+         }
+      }
+
+      /**
+       * @brief Replace the held alternative with the alternative at 'Index' built from 'args'.
+       *
+       * Unless building it cannot throw, the new alternative is built in a temporary before the
+       * held one is destroyed. If it may only be built in place, the held alternative is moved
+       * aside first & moved back if the construction throws.
+       */
+      template <std::size_t Index, typename... Args>
+      constexpr void replace(Args&&... args)
+      {
+         using type = alternative_type<Index>;
+         auto& value = detail::get_alternative<Index>(m_storage);
+
+         if constexpr (std::is_nothrow_constructible_v<type, Args...>)
+         {
+            destroy();
+            std::construct_at(&value, std::forward<Args>(args)...);
+         }
+         else if constexpr (std::is_nothrow_move_constructible_v<type>)
+         {
+            type temporary(std::forward<Args>(args)...);
+
+            destroy();
+            std::construct_at(&value, std::move(temporary));
+         }
+         else
+         {
+            sum previous(std::move(*this));
+            destroy();
+
+#if defined(__cpp_exceptions)
+            try
+            {
+               std::construct_at(&value, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+               restore(std::move(previous));
+
+               throw;
+            }
+#else
+            std::construct_at(&value, std::forward<Args>(args)...);
+#endif // defined(__cpp_exceptions)
+         }
+
+         m_index = static_cast<index_type>(Index);
+      }
+      /**
+       * @brief Move the alternative of 'previous' back into the destroyed storage of the monad.
+       * Failing to do so would leave the monad without an alternative, so it terminates instead.
+       */
+      constexpr void restore(sum&& previous) noexcept
+      {
+         detail::dispatch<alternative_count>(
+            previous.m_index, [&]<std::size_t I>(detail::index_constant<I>) {
+               std::construct_at(&detail::get_alternative<I>(m_storage),
+                                 std::move(detail::get_alternative<I>(previous.m_storage)));
+            });
+      }
+
+   private:
+      detail::sum_storage<Types...> m_storage;
+      index_type m_index = 0;
+   };
+
+   template <typename... Types>
+   constexpr auto operator==(const sum<Types...>& lhs, const sum<Types...>& rhs) -> bool
+   {
+      if (lhs.index() != rhs.index())
+      {
+         return false;
+      }
+
+      return detail::dispatch<sizeof...(Types)>(
+         lhs.index(), [&]<std::size_t I>(detail::index_constant<I>) -> bool {
+            return lhs.template borrow<I>() == rhs.template borrow<I>();
+         });
+   }
+
+   template <typename... Types, std::size_t Index, typename U>
+   constexpr auto operator==(const sum<Types...>& lhs, const alternative<Index, U>& rhs) -> bool
+   {
+      if constexpr (Index < sizeof...(Types))
+      {
+         return lhs.template is<Index>() ? lhs.template borrow<Index>() == rhs.borrow() : false;
+      }
+      else
+      {
+         return false;
+      }
+   }
+
+   /**
+    * @brief A sum is trivially relocatable when all of its alternatives are.
+    */
+   template <typename... Types>
+   struct is_trivially_relocatable<sum<Types...>> :
+      std::bool_constant<(is_trivially_relocatable_v<Types> and ...)>
+   {};
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_SUM_HPP
@@ -0,0 +1,66 @@
+/**
+ * @file tag_invoke.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the 'tag_invoke' customization point used by the operations
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_TAG_INVOKE_HPP
+#define LIBREGLISSE_TAG_INVOKE_HPP
+
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail::tag_invoke_impl
+   {
+      void tag_invoke() = delete; // NOLINT
+
+      /**
+       * @brief Functor that dispatches a call to the 'tag_invoke' overload found through ADL.
+       */
+      struct tag_invoke_fn
+      {
+         template <typename Tag, typename... Args>
+            requires requires(Tag tag, Args&&... args) {
+               tag_invoke(std::move(tag), std::forward<Args>(args)...);
+            }
+         constexpr auto operator()(Tag tag, Args&&... args) const
+            noexcept(noexcept(tag_invoke(std::move(tag), std::forward<Args>(args)...)))
+               -> decltype(auto)
+         {
+            return tag_invoke(std::move(tag), std::forward<Args>(args)...);
+         }
+      };
+   } // namespace detail::tag_invoke_impl
+
+   inline namespace tag_invoke_cpo
+   {
+      /**
+       * @brief Customization point used to override an operation for a user defined type.
+       *
+       * An operation functor such as 'transform_fn' first looks for a 'tag_invoke(transform_fn,
+       * monad, args...)' overload through argument dependent lookup before falling back to its
+       * own implementation.
+       *
+       * The object lives in its own inline namespace so that the types of the library may
+       * declare 'tag_invoke' hidden friends without conflicting with it.
+       */
+      inline constexpr detail::tag_invoke_impl::tag_invoke_fn tag_invoke = {};
+   } // namespace tag_invoke_cpo
+
+   template <typename Tag, typename... Args>
+   concept tag_invocable = std::invocable<decltype(tag_invoke), Tag, Args...>;
+
+   template <typename Tag, typename... Args>
+   concept nothrow_tag_invocable = tag_invocable<Tag, Args...> and
+      std::is_nothrow_invocable_v<decltype(tag_invoke), Tag, Args...>;
+
+   template <typename Tag, typename... Args>
+   using tag_invoke_result_t = std::invoke_result_t<decltype(tag_invoke), Tag, Args...>;
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_TAG_INVOKE_HPP
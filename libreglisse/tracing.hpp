@@ -0,0 +1,524 @@
+/**
+ * @file tracing.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Contains the opt-in tracing of pipeline stages into the Chrome trace event format
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_TRACING_HPP
+#define LIBREGLISSE_TRACING_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ios>
+#include <locale>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#   include <intrin.h>
+#   define LIBREGLISSE_TRACE_USE_TSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#   include <x86intrin.h>
+#   define LIBREGLISSE_TRACE_USE_TSC
+#endif
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      template <typename T>
+      constexpr auto pretty_function() noexcept -> const char*
+      {
+#if defined(_MSC_VER) && !defined(__clang__)
+         return __FUNCSIG__;
+#else
+         return __PRETTY_FUNCTION__;
+#endif
+      }
+
+      /**
+       * @brief Get the name of a type as spelled by the compiler.
+       */
+      template <typename T>
+      constexpr auto type_name() noexcept -> std::string_view
+      {
+         const std::string_view pretty = pretty_function<T>();
+
+#if defined(_MSC_VER) && !defined(__clang__)
+         const std::string_view prefix = "pretty_function<";
+         const auto first = pretty.find(prefix) + prefix.size();
+         const auto last = pretty.rfind(">(void)");
+#else
+         const std::string_view prefix = "T = ";
+         const auto first = pretty.find(prefix) + prefix.size();
+         const auto last = pretty.rfind(']');
+#endif
+
+         return pretty.substr(first, last - first);
+      }
+
+      /**
+       * @brief Get the name of an operation from the name of its functor, without its namespaces,
+       * template arguments & '_fn' suffix.
+       */
+      template <typename OpFunctor>
+      constexpr auto operation_name() noexcept -> std::string_view
+      {
+         std::string_view name = type_name<OpFunctor>();
+         name = name.substr(0, name.find('<'));
+
+         if (const auto scope = name.rfind("::"); scope != std::string_view::npos)
+         {
+            name.remove_prefix(scope + 2);
+         }
+
+         if (name.ends_with("_fn"))
+         {
+            name.remove_suffix(3);
+         }
+
+         return name;
+      }
+
+      template <std::size_t Size>
+      constexpr auto null_terminated(std::string_view view) noexcept -> std::array<char, Size + 1>
+      {
+         std::array<char, Size + 1> res{};
+         std::ranges::copy(view, std::begin(res));
+
+         return res;
+      }
+
+      template <typename T>
+      inline constexpr auto type_name_storage =
+         null_terminated<type_name<T>().size()>(type_name<T>());
+
+      template <typename OpFunctor>
+      inline constexpr auto operation_name_storage =
+         null_terminated<operation_name<OpFunctor>().size()>(operation_name<OpFunctor>());
+
+      template <typename Func>
+      class traced_fn;
+   } // namespace detail
+
+   /**
+    * @brief Give a name to a callable, used for its stages in the traces.
+    *
+    * The callable is otherwise used as it is, with or without 'LIBREGLISSE_USE_TRACING'.
+    *
+    * @param [in] func The callable to name.
+    * @param [in] name The name of the stage, which must have static storage duration.
+    */
+   template <typename Func>
+   constexpr auto traced(Func&& func, const char* name)
+   {
+      return detail::traced_fn<std::decay_t<Func>>(std::forward<Func>(func), name);
+   }
+
+   namespace detail
+   {
+      template <typename Func>
+      class traced_fn
+      {
+      public:
+         constexpr traced_fn(Func func, const char* name) : m_func(std::move(func)), m_name(name)
+         {}
+
+         template <typename... Args>
+            requires std::invocable<const Func&, Args...>
+         constexpr auto operator()(Args&&... args) const
+            -> std::invoke_result_t<const Func&, Args...>
+         {
+            return std::invoke(m_func, std::forward<Args>(args)...);
+         }
+         template <typename... Args>
+            requires std::invocable<Func&, Args...>
+         constexpr auto operator()(Args&&... args) -> std::invoke_result_t<Func&, Args...>
+         {
+            return std::invoke(m_func, std::forward<Args>(args)...);
+         }
+
+         [[nodiscard]] constexpr auto name() const noexcept -> const char* { return m_name; }
+
+      private:
+         Func m_func;
+         const char* m_name;
+      };
+
+      template <typename T>
+      struct is_traced_fn : std::false_type
+      {
+      };
+
+      template <typename Func>
+      struct is_traced_fn<traced_fn<Func>> : std::true_type
+      {
+      };
+
+      /**
+       * @brief Get the name of the callable used by a stage: the name given through 'traced', or
+       * the name of its type.
+       */
+      template <typename... Params>
+      constexpr auto callable_name([[maybe_unused]] const Params&... params) noexcept
+         -> const char*
+      {
+         if constexpr (sizeof...(Params) == 0)
+         {
+            return "";
+         }
+         else
+         {
+            return [](const auto& func, const auto&...) {
+               using func_t = std::remove_cvref_t<decltype(func)>;
+
+               if constexpr (is_traced_fn<func_t>::value)
+               {
+                  return func.name();
+               }
+               else
+               {
+                  return type_name_storage<func_t>.data();
+               }
+            }(params...);
+         }
+      }
+
+      inline constexpr std::size_t trace_buffer_size = 8192;
+
+      /**
+       * @brief Read a timestamp cheaply. The time stamp counter is used where available and
+       * converted to nanoseconds when the trace is written.
+       */
+      inline auto trace_ticks() noexcept -> std::uint64_t
+      {
+#if defined(LIBREGLISSE_TRACE_USE_TSC)
+         return __rdtsc();
+#else
+         return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                              std::chrono::steady_clock::now().time_since_epoch())
+                                              .count());
+#endif
+      }
+
+      struct trace_epoch
+      {
+         std::uint64_t ticks;
+         std::chrono::steady_clock::time_point time;
+      };
+
+      inline auto first_trace_epoch() noexcept -> const trace_epoch&
+      {
+         static const trace_epoch epoch{trace_ticks(), std::chrono::steady_clock::now()};
+
+         return epoch;
+      }
+
+      /**
+       * @brief A stage that ran from 'begin' to 'end', written as a single complete event.
+       */
+      struct trace_event
+      {
+         std::atomic<const char*> stage = nullptr;
+         std::atomic<const char*> callable = nullptr;
+         std::atomic<std::uint64_t> begin = 0;
+         std::atomic<std::uint64_t> end = 0;
+      };
+
+      /**
+       * @brief A ring of trace events written by a single thread. Once full, new events overwrite
+       * the oldest ones. Buffers are never freed, so they may be written out after their thread
+       * exits.
+       *
+       * The writer bumps 'claimed' before overwriting a slot and 'published' after, so a reader
+       * copying the ring concurrently can discard the events overwritten while it copied them.
+       */
+      struct trace_buffer
+      {
+         std::array<trace_event, trace_buffer_size> events;
+         std::atomic<std::uint64_t> claimed = 0;
+         std::atomic<std::uint64_t> published = 0;
+         std::uint64_t flushed = 0;
+
+         std::uint32_t thread_id = 0;
+         std::atomic<bool> owned = true;
+         trace_buffer* next = nullptr;
+
+         void push(const char* stage, const char* callable, std::uint64_t begin,
+                   std::uint64_t end) noexcept
+         {
+            const std::uint64_t position = published.load(std::memory_order_relaxed);
+            trace_event& event = events[position & (trace_buffer_size - 1)];
+
+            claimed.store(position + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            event.stage.store(stage, std::memory_order_relaxed);
+            event.callable.store(callable, std::memory_order_relaxed);
+            event.begin.store(begin, std::memory_order_relaxed);
+            event.end.store(end, std::memory_order_relaxed);
+
+            published.store(position + 1, std::memory_order_release);
+         }
+      };
+
+      inline std::atomic<trace_buffer*> trace_buffers = nullptr; // NOLINT
+      inline std::atomic<std::uint32_t> trace_buffer_count = 0;  // NOLINT
+      inline std::mutex trace_flush_mutex;                       // NOLINT
+
+      inline auto acquire_trace_buffer() noexcept -> trace_buffer*
+      {
+         static_cast<void>(first_trace_epoch());
+
+         for (trace_buffer* buffer = trace_buffers.load(std::memory_order_acquire);
+              buffer != nullptr; buffer = buffer->next)
+         {
+            bool expected = false;
+            if (buffer->owned.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+               return buffer;
+            }
+         }
+
+         auto* buffer = new (std::nothrow) trace_buffer(); // NOLINT
+         if (buffer == nullptr)
+         {
+            return nullptr;
+         }
+
+         buffer->thread_id = trace_buffer_count.fetch_add(1, std::memory_order_relaxed);
+         buffer->next = trace_buffers.load(std::memory_order_relaxed);
+         while (not trace_buffers.compare_exchange_weak(buffer->next, buffer,
+                                                        std::memory_order_release,
+                                                        std::memory_order_relaxed))
+         {}
+
+         return buffer;
+      }
+
+      class trace_buffer_handle
+      {
+      public:
+         trace_buffer_handle() noexcept : m_buffer(acquire_trace_buffer()) {}
+         trace_buffer_handle(const trace_buffer_handle&) = delete;
+         trace_buffer_handle(trace_buffer_handle&&) = delete;
+         ~trace_buffer_handle()
+         {
+            if (m_buffer)
+            {
+               m_buffer->owned.store(false, std::memory_order_release);
+            }
+         }
+
+         auto operator=(const trace_buffer_handle&) -> trace_buffer_handle& = delete;
+         auto operator=(trace_buffer_handle&&) -> trace_buffer_handle& = delete;
+
+         [[nodiscard]] auto get() const noexcept -> trace_buffer* { return m_buffer; }
+
+      private:
+         trace_buffer* m_buffer;
+      };
+
+      /**
+       * @brief Acquire the buffer of the calling thread, released when the thread exits.
+       */
+      inline auto acquire_local_trace_buffer() noexcept -> trace_buffer*
+      {
+         thread_local trace_buffer_handle handle;
+
+         return handle.get();
+      }
+
+      /**
+       * @brief Get the buffer of the calling thread. The pointer is constant initialized, so
+       * reading it needs no guard, unlike the handle owning the buffer.
+       */
+      inline auto local_trace_buffer() noexcept -> trace_buffer*
+      {
+         thread_local trace_buffer* buffer = nullptr;
+
+         if (buffer == nullptr) [[unlikely]]
+         {
+            buffer = acquire_local_trace_buffer();
+         }
+
+         return buffer;
+      }
+
+      /**
+       * @brief Read the time on construction & emit a single complete event spanning the scope on
+       * destruction. Does nothing during constant evaluation.
+       */
+      class trace_scope
+      {
+      public:
+         constexpr trace_scope(const char* stage, const char* callable) noexcept :
+            m_stage(stage), m_callable(callable)
+         {
+            if (not std::is_constant_evaluated())
+            {
+               m_buffer = local_trace_buffer();
+               if (m_buffer)
+               {
+                  m_begin = trace_ticks();
+               }
+            }
+         }
+         trace_scope(const trace_scope&) = delete;
+         trace_scope(trace_scope&&) = delete;
+         constexpr ~trace_scope()
+         {
+            if (not std::is_constant_evaluated() and m_buffer)
+            {
+               m_buffer->push(m_stage, m_callable, m_begin, trace_ticks());
+            }
+         }
+
+         auto operator=(const trace_scope&) -> trace_scope& = delete;
+         auto operator=(trace_scope&&) -> trace_scope& = delete;
+
+      private:
+         const char* m_stage;
+         const char* m_callable;
+         trace_buffer* m_buffer = nullptr;
+         std::uint64_t m_begin = 0;
+      };
+
+      inline void write_json_string(std::ostream& os, std::string_view str)
+      {
+         os << '"';
+
+         for (const char c : str)
+         {
+            if (c == '"' or c == '\\')
+            {
+               os << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) >= 0x20) // NOLINT
+            {
+               os << c;
+            }
+         }
+
+         os << '"';
+      }
+   } // namespace detail
+
+   /**
+    * @brief Write the stages traced since the last call as a Chrome trace event JSON document,
+    * readable by Perfetto & chrome://tracing. Each stage is a single complete event. The buffers
+    * of every thread are drained.
+    *
+    * Times are written in microseconds with a fixed nanosecond precision, whatever the format
+    * flags & locale of 'os', which are restored afterwards.
+    *
+    * Threads may keep tracing while the events are written. Events overwritten before they could
+    * be written out, because a thread traced more than a buffer holds, are lost.
+    *
+    * @returns The number of events written.
+    */
+   inline auto write_trace(std::ostream& os) -> std::size_t
+   {
+      const std::lock_guard lock(detail::trace_flush_mutex);
+
+      const detail::trace_epoch& epoch = detail::first_trace_epoch();
+      const std::uint64_t now_ticks = detail::trace_ticks();
+      const auto now = std::chrono::steady_clock::now();
+
+      const double elapsed_ns = std::chrono::duration<double, std::nano>(now - epoch.time).count();
+      const double ns_per_tick = now_ticks > epoch.ticks
+         ? elapsed_ns / static_cast<double>(now_ticks - epoch.ticks)
+         : 1.0;
+
+      struct copied_event
+      {
+         const char* stage;
+         const char* callable;
+         std::uint64_t begin;
+         std::uint64_t end;
+      };
+
+      std::vector<copied_event> copied;
+      std::size_t count = 0;
+
+      const std::ios_base::fmtflags flags = os.flags(std::ios_base::dec | std::ios_base::fixed);
+      const std::streamsize precision = os.precision(3);
+      const std::locale locale = os.imbue(std::locale::classic());
+
+      os << "{\"traceEvents\":[";
+
+      for (detail::trace_buffer* buffer = detail::trace_buffers.load(std::memory_order_acquire);
+           buffer != nullptr; buffer = buffer->next)
+      {
+         const std::uint64_t last = buffer->published.load(std::memory_order_acquire);
+         const std::uint64_t oldest = last > detail::trace_buffer_size
+            ? last - detail::trace_buffer_size
+            : 0;
+         const std::uint64_t first = std::max(buffer->flushed, oldest);
+
+         copied.clear();
+         for (std::uint64_t i = first; i < last; ++i)
+         {
+            const detail::trace_event& event = buffer->events[i & (detail::trace_buffer_size - 1)];
+
+            copied.push_back({.stage = event.stage.load(std::memory_order_relaxed),
+                              .callable = event.callable.load(std::memory_order_relaxed),
+                              .begin = event.begin.load(std::memory_order_relaxed),
+                              .end = event.end.load(std::memory_order_relaxed)});
+         }
+
+         std::atomic_thread_fence(std::memory_order_acquire);
+
+         const std::uint64_t claimed = buffer->claimed.load(std::memory_order_relaxed);
+         const std::uint64_t valid = claimed > detail::trace_buffer_size
+            ? claimed - detail::trace_buffer_size
+            : 0;
+
+         for (std::uint64_t i = std::max(first, valid); i < last; ++i)
+         {
+            const copied_event& event = copied[i - first];
+            const double timestamp_us =
+               std::max(static_cast<double>(event.begin) - static_cast<double>(epoch.ticks), 0.0) *
+               ns_per_tick / 1000.0; // NOLINT
+            const double duration_us = event.end > event.begin
+               ? static_cast<double>(event.end - event.begin) * ns_per_tick / 1000.0 // NOLINT
+               : 0.0;
+
+            os << (count == 0 ? "\n" : ",\n") << "{\"name\":";
+            detail::write_json_string(os, event.stage);
+            os << ",\"cat\":\"libreglisse\",\"ph\":\"X\",\"ts\":" << timestamp_us
+               << ",\"dur\":" << duration_us << ",\"pid\":1,\"tid\":" << buffer->thread_id
+               << ",\"args\":{\"callable\":";
+            detail::write_json_string(os, event.callable);
+            os << "}}";
+
+            ++count;
+         }
+
+         buffer->flushed = last;
+      }
+
+      os << "\n]}\n";
+
+      os.imbue(locale);
+      os.precision(precision);
+      os.flags(flags);
+
+      return count;
+   }
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_TRACING_HPP
@@ -0,0 +1,815 @@
+/**
+ * @file validated.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the validated monad, accumulating every error instead of stopping at the first
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_VALIDATED_HPP
+#define LIBREGLISSE_VALIDATED_HPP
+
+#include <libreglisse/detail/monad_access.hpp>
+#include <libreglisse/relocate.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/apply.hpp>
+#include <libreglisse/operations/transform.hpp>
+#include <libreglisse/operations/transform_err.hpp>
+#include <libreglisse/operations/zip.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <memory_resource>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   /**
+    * @brief A list of errors storing its first 'N' elements inline.
+    *
+    * Once more than 'N' errors are added, the elements are moved to a buffer allocated from the
+    * memory resource of the list, which may be an arena such as a
+    * 'std::pmr::monotonic_buffer_resource'.
+    */
+   template <typename E, std::size_t N>
+      requires(N > 0) and std::is_nothrow_move_constructible_v<E>
+   class error_list
+   {
+   public:
+      using value_type = E;
+      using size_type = std::size_t;
+      using iterator = E*;
+      using const_iterator = const E*;
+
+   public:
+      /**
+       * @brief Construct an empty list using the default memory resource.
+       */
+      error_list() noexcept : error_list(std::pmr::get_default_resource()) {}
+      /**
+       * @brief Construct an empty list allocating from 'resource' once the inline storage is
+       * full.
+       */
+      explicit error_list(std::pmr::memory_resource* resource) noexcept :
+         m_data(inline_data()), m_resource(resource)
+      {}
+      /**
+       * @brief Construct a list holding 'errors'.
+       */
+      error_list(std::initializer_list<E> errors,
+                 std::pmr::memory_resource* resource = std::pmr::get_default_resource()) :
+         error_list(resource)
+      {
+         for (const E& error : errors)
+         {
+            push_back(error);
+         }
+      }
+      error_list(const error_list& other) : error_list(other.m_resource) { append(other); }
+      error_list(error_list&& other) noexcept : error_list(other.m_resource)
+      {
+         steal(other);
+      }
+      ~error_list()
+      {
+         clear();
+         release();
+      }
+
+      auto operator=(const error_list& rhs) -> error_list&
+      {
+         if (this != &rhs)
+         {
+            clear();
+            append(rhs);
+         }
+
+         return *this;
+      }
+      auto operator=(error_list&& rhs) -> error_list&
+      {
+         if (this != &rhs)
+         {
+            clear();
+
+            if (m_resource == rhs.m_resource or rhs.is_inline())
+            {
+               release();
+               steal(rhs);
+            }
+            else
+            {
+               append(std::move(rhs));
+            }
+         }
+
+         return *this;
+      }
+
+      /**
+       * @brief Construct an error at the end of the list.
+       *
+       * When the list is full, the error is constructed in the new buffer before the others are
+       * relocated, so 'args' may refer to an error of the list.
+       */
+      template <typename... Args>
+         requires std::constructible_from<E, Args...>
+      auto emplace_back(Args&&... args) -> E&
+      {
+         if (m_size == m_capacity)
+         {
+            const size_type capacity = m_capacity * 2;
+            E* buffer = allocate(capacity);
+            E* res = nullptr;
+
+#if defined(__cpp_exceptions)
+            try
+            {
+               res = std::construct_at(buffer + m_size, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+               m_resource->deallocate(buffer, capacity * sizeof(E), alignof(E));
+               throw;
+            }
+#else
+            res = std::construct_at(buffer + m_size, std::forward<Args>(args)...);
+#endif // defined(__cpp_exceptions)
+
+            adopt(buffer, capacity);
+            ++m_size;
+
+            return *res;
+         }
+
+         E* res = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+         ++m_size;
+
+         return *res;
+      }
+      void push_back(const E& error) { emplace_back(error); }
+      void push_back(E&& error) { emplace_back(std::move(error)); }
+
+      /**
+       * @brief Copy the errors of 'other' at the end of the list.
+       */
+      void append(const error_list& other)
+      {
+         reserve(m_size + other.size());
+
+         for (const E& error : other)
+         {
+            emplace_back(error);
+         }
+      }
+      /**
+       * @brief Move the errors of 'other' at the end of the list, leaving it empty.
+       */
+      void append(error_list&& other)
+      {
+         reserve(m_size + other.size());
+
+         for (E& error : other)
+         {
+            emplace_back(std::move(error));
+         }
+
+         other.clear();
+      }
+
+      void reserve(size_type capacity)
+      {
+         if (capacity > m_capacity)
+         {
+            grow(std::max(capacity, m_capacity * 2));
+         }
+      }
+      void clear() noexcept
+      {
+         std::destroy_n(m_data, m_size);
+         m_size = 0;
+      }
+
+      [[nodiscard]] auto size() const noexcept -> size_type { return m_size; }
+      [[nodiscard]] auto empty() const noexcept -> bool { return m_size == 0; }
+      [[nodiscard]] auto capacity() const noexcept -> size_type { return m_capacity; }
+
+      /**
+       * @brief Check if the errors are stored inline, without any allocation.
+       */
+      [[nodiscard]] auto is_inline() const noexcept -> bool { return m_data == inline_data(); }
+      [[nodiscard]] auto resource() const noexcept -> std::pmr::memory_resource*
+      {
+         return m_resource;
+      }
+
+      [[nodiscard]] auto data() noexcept -> E* { return m_data; }
+      [[nodiscard]] auto data() const noexcept -> const E* { return m_data; }
+
+      [[nodiscard]] auto begin() noexcept -> iterator { return m_data; }
+      [[nodiscard]] auto begin() const noexcept -> const_iterator { return m_data; }
+      [[nodiscard]] auto end() noexcept -> iterator { return m_data + m_size; }
+      [[nodiscard]] auto end() const noexcept -> const_iterator { return m_data + m_size; }
+
+      auto operator[](size_type index) noexcept -> E&
+      {
+         assert(index < m_size); // NOLINT
+
+         return m_data[index];
+      }
+      auto operator[](size_type index) const noexcept -> const E&
+      {
+         assert(index < m_size); // NOLINT
+
+         return m_data[index];
+      }
+
+      operator std::span<const E>() const noexcept { return {m_data, m_size}; } // NOLINT
+
+      friend auto operator==(const error_list& lhs, const error_list& rhs) -> bool
+      {
+         return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+      }
+
+   private:
+      auto inline_data() noexcept -> E* { return reinterpret_cast<E*>(m_inline.data()); } // NOLINT
+      auto inline_data() const noexcept -> const E*
+      {
+         return reinterpret_cast<const E*>(m_inline.data()); // NOLINT
+      }
+
+      auto allocate(size_type capacity) -> E*
+      {
+         return static_cast<E*>(m_resource->allocate(capacity * sizeof(E), alignof(E)));
+      }
+      /**
+       * @brief Relocate the errors to 'buffer', allocated from the resource with 'capacity'
+       * elements, & release the current buffer.
+       */
+      void adopt(E* buffer, size_type capacity)
+      {
+         uninitialized_relocate(m_data, m_data + m_size, buffer);
+         release();
+
+         m_data = buffer;
+         m_capacity = capacity;
+      }
+      void grow(size_type capacity) { adopt(allocate(capacity), capacity); }
+      void release() noexcept
+      {
+         if (not is_inline())
+         {
+            m_resource->deallocate(m_data, m_capacity * sizeof(E), alignof(E));
+
+            m_data = inline_data();
+            m_capacity = N;
+         }
+      }
+
+      /**
+       * @brief Take the errors of 'other', which must use the same resource or be inline. This
+       * list must be empty & inline.
+       */
+      void steal(error_list& other) noexcept
+      {
+         if (other.is_inline())
+         {
+            uninitialized_relocate(other.m_data, other.m_data + other.m_size, m_data);
+            m_size = std::exchange(other.m_size, 0);
+         }
+         else
+         {
+            m_data = std::exchange(other.m_data, other.inline_data());
+            m_size = std::exchange(other.m_size, 0);
+            m_capacity = std::exchange(other.m_capacity, N);
+         }
+      }
+
+   private:
+      E* m_data;
+      size_type m_size = 0;
+      size_type m_capacity = N;
+      std::pmr::memory_resource* m_resource;
+
+      alignas(E) std::array<std::byte, sizeof(E) * N> m_inline;
+   };
+
+   template <typename T, typename E, std::size_t N>
+   class validated;
+
+   namespace detail
+   {
+      template <typename Type>
+      struct is_validated : std::false_type
+      {
+      };
+
+      template <typename T, typename E, std::size_t N>
+      struct is_validated<validated<T, E, N>> : std::true_type
+      {
+      };
+
+      template <typename Type, typename E, std::size_t N>
+      concept validated_of = is_validated<std::remove_cvref_t<Type>>::value and
+         std::same_as<typename std::remove_cvref_t<Type>::error_type, error_list<E, N>>;
+   } // namespace detail
+
+   /**
+    * @brief A monadic type holding either a value or a non-empty list of errors.
+    *
+    * Unlike result, combining validated monads through 'zip' or 'apply' keeps the errors of every
+    * one of them, which allows checking every field of a record at once. The errors are stored
+    * in an 'error_list' with an inline capacity of 'N', so combining valid monads never
+    * allocates & combining a few errors neither.
+    */
+   template <typename T, typename E, std::size_t N = 4>
+   class validated
+   {
+   public:
+      using value_type = T;
+      using error_type = error_list<E, N>;
+
+   public:
+      validated() = delete;
+      validated(ok<value_type>&& value) : m_is_ok(true)
+      {
+         std::construct_at(&m_value, std::move(value).value()); // NOLINT
+      }
+      validated(err<E>&& error) : m_is_ok(false)
+      {
+         std::construct_at(&m_errors);                 // NOLINT
+         m_errors.push_back(std::move(error).value()); // NOLINT
+      }
+      /**
+       * @brief Construct an invalid monad from a list of errors, which must not be empty.
+       */
+      validated(err<error_type>&& errors) : m_is_ok(false)
+      {
+         std::construct_at(&m_errors, std::move(errors).value()); // NOLINT
+
+         assert(not m_errors.empty() && "validated requires at least one error"); // NOLINT
+      }
+      /**
+       * @brief Convert a result to a validated monad.
+       */
+      validated(const result<value_type, E>& res) : m_is_ok(res.is_ok())
+      {
+         if (is_ok())
+         {
+            std::construct_at(&m_value, res.borrow()); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_errors);         // NOLINT
+            m_errors.push_back(res.borrow_err()); // NOLINT
+         }
+      }
+      /**
+       * @brief Convert a result to a validated monad.
+       */
+      validated(result<value_type, E>&& res) : m_is_ok(res.is_ok())
+      {
+         if (is_ok())
+         {
+            std::construct_at(&m_value, std::move(res).take()); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_errors);                  // NOLINT
+            m_errors.push_back(std::move(res).take_err()); // NOLINT
+         }
+      }
+      validated(const validated& other) : m_is_ok(other.m_is_ok)
+      {
+         if (is_ok())
+         {
+            std::construct_at(&m_value, other.m_value); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_errors, other.m_errors); // NOLINT
+         }
+      }
+      validated(validated&& other) noexcept(std::is_nothrow_move_constructible_v<value_type>) :
+         m_is_ok(other.m_is_ok)
+      {
+         if (is_ok())
+         {
+            std::construct_at(&m_value, std::move(other.m_value)); // NOLINT
+         }
+         else
+         {
+            std::construct_at(&m_errors, std::move(other.m_errors)); // NOLINT
+         }
+      }
+      ~validated() { destroy(); }
+
+      /**
+       * @brief Copy assign a validated monad.
+       *
+       * If both monads hold a value, the value is assigned in place to reuse its storage.
+       * Otherwise 'rhs' is copied before anything is destroyed, so a throwing copy leaves the
+       * monad untouched.
+       */
+      auto operator=(const validated& rhs) -> validated&
+      {
+         if (this != &rhs)
+         {
+            if constexpr (std::is_copy_assignable_v<value_type>)
+            {
+               if (is_ok() && rhs.is_ok())
+               {
+                  m_value = rhs.m_value; // NOLINT
+
+                  return *this;
+               }
+            }
+
+            validated copy(rhs);
+            *this = std::move(copy);
+         }
+
+         return *this;
+      }
+      /**
+       * @brief Move assign a validated monad.
+       *
+       * If both monads hold a value, the value is move assigned in place to reuse its storage.
+       * If the value replacing the errors throws while being moved, the errors are restored, so
+       * the monad is never left without an alternative.
+       */
+      auto operator=(validated&& rhs) noexcept(std::is_nothrow_move_constructible_v<value_type> and
+                                               std::is_nothrow_move_assignable_v<value_type>)
+         -> validated&
+      {
+         if (this != &rhs)
+         {
+            if (is_ok() && rhs.is_ok())
+            {
+               if constexpr (std::is_move_assignable_v<value_type>)
+               {
+                  m_value = std::move(rhs.m_value); // NOLINT
+               }
+               else
+               {
+                  std::destroy_at(&m_value);                           // NOLINT
+                  std::construct_at(&m_value, std::move(rhs.m_value)); // NOLINT
+               }
+            }
+            else if (is_err() && rhs.is_err())
+            {
+               std::destroy_at(&m_errors);                            // NOLINT
+               std::construct_at(&m_errors, std::move(rhs.m_errors)); // NOLINT
+            }
+            else if (rhs.is_ok())
+            {
+               replace_errors(std::move(rhs.m_value)); // NOLINT
+            }
+            else
+            {
+               std::destroy_at(&m_value);                             // NOLINT
+               std::construct_at(&m_errors, std::move(rhs.m_errors)); // NOLINT
+               m_is_ok = false;
+            }
+         }
+
+         return *this;
+      }
+
+      auto borrow() const& -> const value_type&
+      {
+         detail::handle_invalid_value_result_access(is_ok());
+
+         return m_value; // NOLINT
+      }
+      auto borrow() & -> value_type&
+      {
+         detail::handle_invalid_value_result_access(is_ok());
+
+         return m_value; // NOLINT
+      }
+      auto take() && -> value_type
+      {
+         detail::handle_invalid_value_result_access(is_ok());
+
+         return std::move(m_value); // NOLINT
+      }
+
+      auto borrow_err() const& -> const error_type&
+      {
+         detail::handle_invalid_error_result_access(is_err());
+
+         return m_errors; // NOLINT
+      }
+      auto borrow_err() & -> error_type&
+      {
+         detail::handle_invalid_error_result_access(is_err());
+
+         return m_errors; // NOLINT
+      }
+      auto take_err() && -> error_type
+      {
+         detail::handle_invalid_error_result_access(is_err());
+
+         return std::move(m_errors); // NOLINT
+      }
+
+      /**
+       * @brief Get the errors held by the monad, or an empty span if it holds a value.
+       */
+      [[nodiscard]] auto errors() const noexcept -> std::span<const E>
+      {
+         if (is_ok())
+         {
+            return {};
+         }
+
+         return m_errors; // NOLINT
+      }
+
+      /**
+       * @brief Convert the monad to a result holding the value or the list of errors.
+       */
+      auto to_result() const& -> result<value_type, error_type>
+      {
+         if (is_ok())
+         {
+            return ok(m_value); // NOLINT
+         }
+
+         return err(m_errors); // NOLINT
+      }
+      /**
+       * @brief Convert the monad to a result holding the value or the list of errors.
+       */
+      auto to_result() && -> result<value_type, error_type>
+      {
+         if (is_ok())
+         {
+            return ok(std::move(m_value)); // NOLINT
+         }
+
+         return err(std::move(m_errors)); // NOLINT
+      }
+
+      [[nodiscard]] auto is_ok() const noexcept -> bool { return m_is_ok; }
+      [[nodiscard]] auto is_err() const noexcept -> bool { return not is_ok(); }
+      explicit operator bool() const noexcept { return is_ok(); }
+
+      /**
+       * @brief Transform the value of the monad, keeping its errors otherwise.
+       */
+      template <std::invocable<const value_type&> Func>
+      friend auto tag_invoke(transform_fn /* tag */, const validated& v, Func&& func)
+         -> validated<std::invoke_result_t<Func, const value_type&>, E, N>
+      {
+         if (v.is_ok())
+         {
+            return ok(std::invoke(std::forward<Func>(func), v.m_value));
+         }
+
+         return err(v.m_errors);
+      }
+      /**
+       * @brief Transform the value of the monad, keeping its errors otherwise.
+       */
+      template <std::invocable<value_type> Func>
+      friend auto tag_invoke(transform_fn /* tag */, validated&& v, Func&& func)
+         -> validated<std::invoke_result_t<Func, value_type>, E, N>
+      {
+         if (v.is_ok())
+         {
+            return ok(std::invoke(std::forward<Func>(func), std::move(v.m_value)));
+         }
+
+         return err(std::move(v.m_errors));
+      }
+
+      /**
+       * @brief Transform every error of the monad, keeping its value otherwise.
+       */
+      template <std::invocable<const E&> Func>
+      friend auto tag_invoke(transform_err_fn /* tag */, const validated& v, Func&& func)
+         -> validated<value_type, std::invoke_result_t<Func, const E&>, N>
+      {
+         if (v.is_ok())
+         {
+            return ok(v.m_value);
+         }
+
+         error_list<std::invoke_result_t<Func, const E&>, N> errors(v.m_errors.resource());
+         errors.reserve(v.m_errors.size());
+
+         for (const E& error : v.m_errors)
+         {
+            errors.push_back(std::invoke(func, error));
+         }
+
+         return err(std::move(errors));
+      }
+      /**
+       * @brief Transform every error of the monad, keeping its value otherwise.
+       */
+      template <std::invocable<E> Func>
+      friend auto tag_invoke(transform_err_fn /* tag */, validated&& v, Func&& func)
+         -> validated<value_type, std::invoke_result_t<Func, E>, N>
+      {
+         if (v.is_ok())
+         {
+            return ok(std::move(v.m_value));
+         }
+
+         error_list<std::invoke_result_t<Func, E>, N> errors(v.m_errors.resource());
+         errors.reserve(v.m_errors.size());
+
+         for (E& error : v.m_errors)
+         {
+            errors.push_back(std::invoke(func, std::move(error)));
+         }
+
+         return err(std::move(errors));
+      }
+
+      /**
+       * @brief Combine the values of validated monads into a tuple, or accumulate all of their
+       * errors.
+       */
+      template <detail::validated_of<E, N>... Rest>
+         requires(sizeof...(Rest) >= 1)
+      friend auto tag_invoke(zip_fn /* tag */, const validated& first, Rest&&... rest)
+      {
+         return validated::zip_impl(first, std::forward<Rest>(rest)...);
+      }
+      /**
+       * @brief Combine the values of validated monads into a tuple, or accumulate all of their
+       * errors.
+       */
+      template <detail::validated_of<E, N>... Rest>
+         requires(sizeof...(Rest) >= 1)
+      friend auto tag_invoke(zip_fn /* tag */, validated&& first, Rest&&... rest)
+      {
+         return validated::zip_impl(std::move(first), std::forward<Rest>(rest)...);
+      }
+
+      /**
+       * @brief Call a function with the values of validated monads, or accumulate all of their
+       * errors.
+       */
+      template <typename Func, detail::validated_of<E, N>... Rest>
+         requires std::invocable<Func, const value_type&, detail::forward_value_t<Rest>...>
+      friend auto tag_invoke(apply_fn /* tag */, Func&& func, const validated& first,
+                             Rest&&... rest)
+      {
+         return validated::apply_impl(std::forward<Func>(func), first,
+                                      std::forward<Rest>(rest)...);
+      }
+      /**
+       * @brief Call a function with the values of validated monads, or accumulate all of their
+       * errors.
+       */
+      template <typename Func, detail::validated_of<E, N>... Rest>
+         requires std::invocable<Func, value_type, detail::forward_value_t<Rest>...>
+      friend auto tag_invoke(apply_fn /* tag */, Func&& func, validated&& first, Rest&&... rest)
+      {
+         return validated::apply_impl(std::forward<Func>(func), std::move(first),
+                                      std::forward<Rest>(rest)...);
+      }
+
+      /**
+       * @brief Call a function with the unpacked tuple held by the monad, keeping its errors
+       * otherwise.
+       */
+      template <typename Func>
+         requires detail::applicable<Func, const value_type&>
+      friend auto tag_invoke(apply_fn /* tag */, const validated& v, Func&& func)
+      {
+         return tag_invoke(transform_fn(), v, [&](const value_type& values) {
+            return std::apply(std::forward<Func>(func), values);
+         });
+      }
+      /**
+       * @brief Call a function with the unpacked tuple held by the monad, keeping its errors
+       * otherwise.
+       */
+      template <typename Func>
+         requires detail::applicable<Func, value_type>
+      friend auto tag_invoke(apply_fn /* tag */, validated&& v, Func&& func)
+      {
+         return tag_invoke(transform_fn(), std::move(v), [&](value_type&& values) {
+            return std::apply(std::forward<Func>(func), std::move(values));
+         });
+      }
+
+   private:
+      template <typename... Monads>
+      static auto zip_impl(Monads&&... ms)
+      {
+         using tuple_t = std::tuple<std::remove_cvref_t<detail::forward_value_t<Monads>>...>;
+         using res_t = validated<tuple_t, E, N>;
+
+         if (detail::all_ok(ms...))
+         {
+            return res_t(ok(tuple_t(detail::forward_value(std::forward<Monads>(ms))...)));
+         }
+
+         return res_t(err(merge_errors(std::forward<Monads>(ms)...)));
+      }
+
+      template <typename Func, typename... Monads>
+      static auto apply_impl(Func&& func, Monads&&... ms)
+      {
+         using res_t =
+            validated<std::invoke_result_t<Func, detail::forward_value_t<Monads>...>, E, N>;
+
+         if (detail::all_ok(ms...))
+         {
+            return res_t(ok(std::invoke(std::forward<Func>(func),
+                                        detail::forward_value(std::forward<Monads>(ms))...)));
+         }
+
+         return res_t(err(merge_errors(std::forward<Monads>(ms)...)));
+      }
+
+      /**
+       * @brief Gather the errors of every invalid monad, in order, using the memory resource of
+       * the first one.
+       */
+      template <typename... Monads>
+      static auto merge_errors(Monads&&... ms) -> error_type
+      {
+         std::pmr::memory_resource* resource = nullptr;
+         ((resource = resource == nullptr and ms.is_err() ? ms.borrow_err().resource() : resource),
+          ...);
+
+         error_type res(resource);
+         (
+            [&]<typename Monad>(Monad&& m) {
+               if (m.is_err())
+               {
+                  res.append(detail::forward_error(std::forward<Monad>(m)));
+               }
+            }(std::forward<Monads>(ms)),
+            ...);
+
+         return res;
+      }
+
+      void destroy() noexcept
+      {
+         if (is_ok())
+         {
+            std::destroy_at(&m_value); // NOLINT
+         }
+         else
+         {
+            std::destroy_at(&m_errors); // NOLINT
+         }
+      }
+      /**
+       * @brief Replace the errors held by the monad with 'value'. Moving the errors never throws,
+       * so they are moved aside & put back if moving the value throws.
+       */
+      void replace_errors(value_type&& value)
+      {
+         error_type errors(std::move(m_errors)); // NOLINT
+         std::destroy_at(&m_errors);             // NOLINT
+
+#if defined(__cpp_exceptions)
+         try
+         {
+            std::construct_at(&m_value, std::move(value)); // NOLINT
+         }
+         catch (...)
+         {
+            std::construct_at(&m_errors, std::move(errors)); // NOLINT
+
+            throw;
+         }
+#else
+         std::construct_at(&m_value, std::move(value)); // NOLINT
+#endif // defined(__cpp_exceptions)
+
+         m_is_ok = true;
+      }
+
+   private:
+      bool m_is_ok;
+
+      union
+      {
+         value_type m_value;
+         error_type m_errors;
+      };
+   };
+} // namespace reglisse::v0
+
+#endif // LIBREGLISSE_VALIDATED_HPP
@@ -0,0 +1,416 @@
+/**
+ * @file views.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Sunday, 18th of October 2026
+ * @brief Contains the range adaptors over ranges of monads
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_VIEWS_HPP
+#define LIBREGLISSE_VIEWS_HPP
+
+#include <libreglisse/concepts.hpp>
+#include <libreglisse/detail/monad_access.hpp>
+#include <libreglisse/maybe.hpp>
+
+#include <concepts>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::inline v0
+{
+   namespace detail
+   {
+      template <typename Type>
+      struct is_maybe : std::false_type
+      {
+      };
+
+      template <typename T>
+      struct is_maybe<maybe<T>> : std::true_type
+      {
+      };
+
+      template <typename View, typename Func>
+      using filter_map_result_t =
+         std::remove_cvref_t<std::invoke_result_t<Func&, std::ranges::range_reference_t<View>>>;
+
+      template <typename Range>
+      using range_monad_t = std::remove_cvref_t<std::ranges::range_reference_t<Range>>;
+
+      /**
+       * @brief Holds the function of a view, making it assignable even if the function is not.
+       */
+      template <std::copy_constructible Func>
+         requires std::is_object_v<Func>
+      class function_box
+      {
+      public:
+         constexpr function_box() noexcept(std::is_nothrow_default_constructible_v<Func>)
+            requires std::default_initializable<Func>
+            : m_func()
+         {}
+         explicit constexpr function_box(Func func) : m_func(std::move(func)) {}
+
+         constexpr function_box(const function_box&) = default;
+         constexpr function_box(function_box&&) noexcept = default;
+         constexpr ~function_box() = default;
+
+         constexpr auto operator=(const function_box& rhs) -> function_box&
+         {
+            if (this != &rhs)
+            {
+               if constexpr (std::is_copy_assignable_v<Func>)
+               {
+                  m_func = rhs.m_func;
+               }
+               else
+               {
+                  std::destroy_at(std::addressof(m_func));
+                  std::construct_at(std::addressof(m_func), rhs.m_func);
+               }
+            }
+
+            return *this;
+         }
+         constexpr auto operator=(function_box&& rhs) noexcept -> function_box&
+         {
+            if (this != &rhs)
+            {
+               if constexpr (std::is_move_assignable_v<Func>)
+               {
+                  m_func = std::move(rhs.m_func);
+               }
+               else
+               {
+                  std::destroy_at(std::addressof(m_func));
+                  std::construct_at(std::addressof(m_func), std::move(rhs.m_func));
+               }
+            }
+
+            return *this;
+         }
+
+         constexpr auto operator*() const noexcept -> const Func& { return m_func; }
+         constexpr auto operator*() noexcept -> Func& { return m_func; }
+
+      private:
+         Func m_func;
+      };
+
+      struct has_value_fn
+      {
+         template <typename Monad>
+         constexpr auto operator()(const Monad& m) const noexcept -> bool
+         {
+            if constexpr (maybe_monad<Monad>)
+            {
+               return m.is_some();
+            }
+            else
+            {
+               return m.is_ok();
+            }
+         }
+      };
+      struct has_error_fn
+      {
+         template <result_monad Monad>
+         constexpr auto operator()(const Monad& m) const noexcept -> bool
+         {
+            return m.is_err();
+         }
+      };
+      struct is_left_fn
+      {
+         template <either_monad Monad>
+         constexpr auto operator()(const Monad& m) const noexcept -> bool
+         {
+            return m.is_left();
+         }
+      };
+      struct is_right_fn
+      {
+         template <either_monad Monad>
+         constexpr auto operator()(const Monad& m) const noexcept -> bool
+         {
+            return m.is_right();
+         }
+      };
+
+      struct value_of_fn
+      {
+         template <typename Monad>
+         constexpr auto operator()(Monad&& m) const -> decltype(auto)
+         {
+            return forward_value(std::forward<Monad>(m));
+         }
+      };
+      struct error_of_fn
+      {
+         template <typename Monad>
+         constexpr auto operator()(Monad&& m) const -> decltype(auto)
+         {
+            return forward_error(std::forward<Monad>(m));
+         }
+      };
+      struct left_of_fn
+      {
+         template <typename Monad>
+         constexpr auto operator()(Monad&& m) const -> decltype(auto)
+         {
+            return forward_left(std::forward<Monad>(m));
+         }
+      };
+      struct right_of_fn
+      {
+         template <typename Monad>
+         constexpr auto operator()(Monad&& m) const -> decltype(auto)
+         {
+            return forward_right(std::forward<Monad>(m));
+         }
+      };
+
+      /**
+       * @brief A range adaptor keeping the payloads of the monads of a range that pass 'Filter',
+       * as projected by 'Projection'. The elements of the range are neither copied nor stored.
+       */
+      template <template <typename> typename Constraint, typename Filter, typename Projection>
+      struct payload_adaptor
+      {
+         template <std::ranges::viewable_range Range>
+            requires Constraint<range_monad_t<Range>>::value
+         constexpr auto operator()(Range&& range) const
+         {
+            return std::views::filter(std::forward<Range>(range), Filter()) |
+               std::views::transform(Projection());
+         }
+
+         template <std::ranges::viewable_range Range>
+            requires Constraint<range_monad_t<Range>>::value
+         friend constexpr auto operator|(Range&& range, const payload_adaptor& adaptor)
+         {
+            return adaptor(std::forward<Range>(range));
+         }
+      };
+
+      template <typename Monad>
+      struct valued_monad : std::bool_constant<maybe_monad<Monad> or result_monad<Monad>>
+      {
+      };
+      template <typename Monad>
+      struct erroneous_monad : std::bool_constant<result_monad<Monad>>
+      {
+      };
+      template <typename Monad>
+      struct sided_monad : std::bool_constant<either_monad<Monad>>
+      {
+      };
+   } // namespace detail
+
+   /**
+    * @brief A view of the values of the maybe monads returned by 'Func' for every element of 'View'
+    * that hold one.
+    *
+    * The monad returned for the current element is cached in the view, so 'Func' is called exactly
+    * once per element however many times the iterator is dereferenced. For this reason the view is
+    * an input range.
+    */
+   template <std::ranges::input_range View, std::copy_constructible Func>
+      requires std::ranges::view<View> and std::is_object_v<Func> and
+      std::regular_invocable<Func&, std::ranges::range_reference_t<View>> and
+      detail::is_maybe<detail::filter_map_result_t<View, Func>>::value
+   class filter_map_view : public std::ranges::view_interface<filter_map_view<View, Func>>
+   {
+      using maybe_type = detail::filter_map_result_t<View, Func>;
+
+   public:
+      using value_type = typename maybe_type::value_type;
+
+      class sentinel;
+
+      class iterator
+      {
+      public:
+         using iterator_concept = std::input_iterator_tag;
+         using value_type = typename maybe_type::value_type;
+         using difference_type = std::ranges::range_difference_t<View>;
+
+      public:
+         iterator() = default;
+         constexpr iterator(filter_map_view& parent, std::ranges::iterator_t<View> current) :
+            m_parent(std::addressof(parent)), m_current(std::move(current))
+         {
+            satisfy();
+         }
+
+         constexpr auto operator*() const noexcept -> value_type&
+         {
+            return m_parent->m_cache.borrow();
+         }
+
+         constexpr auto operator++() -> iterator&
+         {
+            ++m_current;
+            satisfy();
+
+            return *this;
+         }
+         constexpr void operator++(int) { ++*this; }
+
+         [[nodiscard]] constexpr auto base() const& -> const std::ranges::iterator_t<View>&
+         {
+            return m_current;
+         }
+
+      private:
+         constexpr void satisfy()
+         {
+            const auto last = std::ranges::end(m_parent->m_base);
+
+            for (; m_current != last; ++m_current)
+            {
+               maybe_type res = std::invoke(*m_parent->m_func, *m_current);
+
+               if (res.is_some())
+               {
+                  m_parent->m_cache = std::move(res);
+                  return;
+               }
+            }
+
+            m_parent->m_cache.reset();
+         }
+
+      private:
+         filter_map_view* m_parent = nullptr;
+         std::ranges::iterator_t<View> m_current = std::ranges::iterator_t<View>();
+      };
+
+      class sentinel
+      {
+      public:
+         sentinel() = default;
+         explicit constexpr sentinel(std::ranges::sentinel_t<View> last) : m_last(std::move(last))
+         {}
+
+         friend constexpr auto operator==(const iterator& it, const sentinel& s) -> bool
+         {
+            return it.base() == s.m_last;
+         }
+
+      private:
+         std::ranges::sentinel_t<View> m_last = std::ranges::sentinel_t<View>();
+      };
+
+   public:
+      filter_map_view() requires std::default_initializable<View> and
+         std::default_initializable<Func>
+      = default;
+      constexpr filter_map_view(View base, Func func) :
+         m_base(std::move(base)), m_func(std::move(func))
+      {}
+
+      /**
+       * @brief Get the iterator to the first element for which 'Func' returns a value.
+       */
+      constexpr auto begin() -> iterator { return iterator(*this, std::ranges::begin(m_base)); }
+      constexpr auto end() -> sentinel { return sentinel(std::ranges::end(m_base)); }
+
+      [[nodiscard]] constexpr auto base() const& -> View
+         requires std::copy_constructible<View>
+      {
+         return m_base;
+      }
+      [[nodiscard]] constexpr auto base() && -> View { return std::move(m_base); }
+
+   private:
+      View m_base = View();
+      detail::function_box<Func> m_func;
+      maybe_type m_cache = none;
+   };
+
+   template <typename Range, typename Func>
+   filter_map_view(Range&&, Func) -> filter_map_view<std::views::all_t<Range>, Func>;
+
+   namespace detail
+   {
+      template <typename Func>
+      struct filter_map_closure
+      {
+         template <std::ranges::viewable_range Range>
+            requires requires(Range&& range, const Func& func) {
+               filter_map_view(std::forward<Range>(range), func);
+            }
+         friend constexpr auto operator|(Range&& range, const filter_map_closure& closure)
+         {
+            return filter_map_view(std::forward<Range>(range), closure.func);
+         }
+
+         Func func;
+      };
+
+      struct filter_map_fn
+      {
+         template <std::ranges::viewable_range Range, typename Func>
+            requires requires(Range&& range, Func&& func) {
+               filter_map_view(std::forward<Range>(range), std::forward<Func>(func));
+            }
+         constexpr auto operator()(Range&& range, Func&& func) const
+         {
+            return filter_map_view(std::forward<Range>(range), std::forward<Func>(func));
+         }
+
+         template <typename Func>
+            requires std::copy_constructible<std::decay_t<Func>>
+         constexpr auto operator()(Func&& func) const
+         {
+            return filter_map_closure<std::decay_t<Func>>{std::forward<Func>(func)};
+         }
+      };
+   } // namespace detail
+} // namespace reglisse::v0
+
+namespace reglisse::inline v0::views
+{
+   /**
+    * @brief Lazily view the values of a range of maybe or result monads, skipping the empty &
+    * erroneous ones. The values are borrowed from lvalue monads.
+    */
+   const constexpr detail::payload_adaptor<detail::valued_monad, detail::has_value_fn,
+                                           detail::value_of_fn>
+      values = {};
+   /**
+    * @brief Lazily view the errors of a range of result monads, skipping the valid ones.
+    */
+   const constexpr detail::payload_adaptor<detail::erroneous_monad, detail::has_error_fn,
+                                           detail::error_of_fn>
+      errors = {};
+   /**
+    * @brief Lazily view the left values of a range of either monads.
+    */
+   const constexpr detail::payload_adaptor<detail::sided_monad, detail::is_left_fn,
+                                           detail::left_of_fn>
+      lefts = {};
+   /**
+    * @brief Lazily view the right values of a range of either monads.
+    */
+   const constexpr detail::payload_adaptor<detail::sided_monad, detail::is_right_fn,
+                                           detail::right_of_fn>
+      rights = {};
+
+   /**
+    * @brief Lazily map every element of a range through a function returning a maybe, keeping
+    * the values of the monads that hold one.
+    *
+    * May be called directly, as in 'filter_map(range, func)', or through a pipe, as in
+    * 'range | filter_map(func)'.
+    */
+   const constexpr detail::filter_map_fn filter_map = {};
+} // namespace reglisse::v0::views
+
+#endif // LIBREGLISSE_VIEWS_HPP
@@ -0,0 +1,161 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/cache.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/transform.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace reglisse;
+
+SCENARIO("clock_cache - lookups & eviction", "[cache]")
+{
+   GIVEN("A single shard cache of three entries")
+   {
+      clock_cache<int, std::string> cache(3, 1);
+
+      REQUIRE(cache.capacity() == 3);
+
+      THEN("Inserted values are found & counted as hits")
+      {
+         cache.insert(1, "one");
+         cache.insert(2, "two");
+
+         REQUIRE(cache.find(1).is_some());
+         CHECK(cache.find(1).borrow() == "one");
+         CHECK(cache.find(3).is_none());
+         CHECK(cache.size() == 2);
+
+         const cache_stats stats = cache.stats();
+         CHECK(stats.hits == 2);
+         CHECK(stats.misses == 1);
+      }
+      THEN("Inserting an existing key replaces its value")
+      {
+         cache.insert(1, "one");
+         cache.insert(1, "uno");
+
+         CHECK(cache.find(1).borrow() == "uno");
+         CHECK(cache.size() == 1);
+      }
+      THEN("Entries referenced since the last sweep survive eviction")
+      {
+         cache.insert(1, "one");
+         cache.insert(2, "two");
+         cache.insert(3, "three");
+
+         static_cast<void>(cache.find(1));
+         static_cast<void>(cache.find(3));
+
+         cache.insert(4, "four");
+
+         CHECK(cache.size() == 3);
+         CHECK(cache.find(1).is_some());
+         CHECK(cache.find(2).is_none());
+         CHECK(cache.find(3).is_some());
+         CHECK(cache.find(4).is_some());
+         CHECK(cache.stats().evictions == 1);
+      }
+      THEN("Clearing the cache removes every entry")
+      {
+         cache.insert(1, "one");
+         cache.clear();
+
+         CHECK(cache.size() == 0);
+         CHECK(cache.find(1).is_none());
+      }
+   }
+}
+
+SCENARIO("cached - memoizing operations", "[cache]")
+{
+   GIVEN("A pure lookup returning results & a cache")
+   {
+      int calls = 0;
+      auto lookup = [&](int key) -> result<std::string, std::string> {
+         ++calls;
+
+         if (key < 0)
+         {
+            return err(std::string("negative key"));
+         }
+
+         return ok(std::to_string(key));
+      };
+
+      clock_cache<int, result<std::string, std::string>> cache(16);
+
+      THEN("Repeated keys are served from the cache")
+      {
+         for (int i = 0; i < 4; ++i)
+         {
+            const result<int, std::string> key = ok(7);
+            const auto res = key | and_then(cached(lookup, cache));
+
+            REQUIRE(res.is_ok());
+            CHECK(res.borrow() == "7");
+         }
+
+         CHECK(calls == 1);
+         CHECK(cache.stats().hits == 3);
+         CHECK(cache.stats().misses == 1);
+      }
+      THEN("Errors are cached as well")
+      {
+         const auto first = cached(lookup, cache)(-1);
+         const auto second = cached(lookup, cache)(-1);
+
+         REQUIRE(first.is_err());
+         REQUIRE(second.is_err());
+         CHECK(second.borrow_err() == "negative key");
+         CHECK(calls == 1);
+      }
+   }
+   GIVEN("A cache shared by several threads")
+   {
+      std::atomic<int> calls = 0;
+      auto square = [&](int key) {
+         calls.fetch_add(1);
+         return key * key;
+      };
+
+      clock_cache<int, int> cache(64, 4);
+
+      THEN("Every lookup returns the right value")
+      {
+         std::vector<std::thread> threads;
+         std::atomic<bool> failed = false;
+
+         for (int t = 0; t < 4; ++t)
+         {
+            threads.emplace_back([&] {
+               auto memoized = cached(square, cache);
+
+               for (int i = 0; i < 1000; ++i)
+               {
+                  if (memoized(i % 32) != (i % 32) * (i % 32))
+                  {
+                     failed = true;
+                  }
+               }
+            });
+         }
+
+         for (auto& thread : threads)
+         {
+            thread.join();
+         }
+
+         CHECK_FALSE(failed.load());
+         CHECK(cache.stats().hits + cache.stats().misses == 4000);
+         CHECK(calls.load() < 4000);
+      }
+   }
+}
@@ -1,9 +1,12 @@
 #define LIBREGLISSE_USE_EXCEPTIONS
 
+#include "../support/counted.hpp"
+
 #include <libreglisse/either.hpp>
 
 #include <catch2/catch.hpp>
 
+#include <string>
 #include <vector>
 
 using namespace reglisse;
@@ -218,3 +221,50 @@ SCENARIO("either - taking", "[either]")
       }
    }
 }
+
+SCENARIO("either - assignment reuses storage", "[either]")
+{
+   GIVEN("two eithers holding the same alternative")
+   {
+      either<test::counted, int> lhs = left(test::counted(1));
+      const either<test::counted, int> rhs = left(test::counted(2));
+
+      WHEN("they are copy and move assigned")
+      {
+         const auto measured = test::measure([&] {
+            lhs = rhs;
+            lhs = either<test::counted, int>(rhs);
+         });
+
+         THEN("the alternative is assigned in place")
+         {
+            CHECK(lhs.is_left());
+            CHECK(measured.copy_assignments == 1);
+            CHECK(measured.move_assignments == 1);
+            CHECK(measured.copies == 1);
+            CHECK(measured.moves == 0);
+         }
+      }
+   }
+   GIVEN("two eithers holding different alternatives")
+   {
+      either<std::string, int> lhs = left(std::string("hello"));
+      const either<std::string, int> rhs = right(1);
+
+      WHEN("the alternatives are switched through assignment")
+      {
+         either<std::string, int> other = right(2);
+
+         lhs = rhs;
+         other = either<std::string, int>(left(std::string("world")));
+
+         THEN("the content follows the assignments")
+         {
+            REQUIRE(lhs.is_right());
+            CHECK(lhs.borrow_right() == 1);
+            REQUIRE(other.is_left());
+            CHECK(other.borrow_left() == "world");
+         }
+      }
+   }
+}
@@ -0,0 +1,186 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/lazy.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace reglisse;
+
+SCENARIO("lazy - evaluation", "[lazy]")
+{
+   GIVEN("A lazy maybe counting its evaluations")
+   {
+      int calls = 0;
+      lazy_maybe<int> value([&] {
+         ++calls;
+         return maybe(some(42));
+      });
+
+      THEN("Nothing is computed until the value is accessed")
+      {
+         CHECK(calls == 0);
+         CHECK_FALSE(value.is_evaluated());
+      }
+      THEN("The value is computed once on first access")
+      {
+         REQUIRE(value.borrow().is_some());
+         CHECK(value.borrow().borrow() == 42);
+         CHECK(value.is_evaluated());
+         CHECK(calls == 1);
+      }
+      THEN("Moving the lazy value keeps its state")
+      {
+         static_cast<void>(value.borrow());
+
+         lazy_maybe<int> moved = std::move(value);
+
+         CHECK(moved.is_evaluated());
+         CHECK(std::move(moved).take().borrow() == 42);
+         CHECK(calls == 1);
+      }
+   }
+   GIVEN("A lazy result whose function throws once")
+   {
+      int calls = 0;
+      lazy_result<int, std::string> value([&]() -> result<int, std::string> {
+         if (calls++ == 0)
+         {
+            throw std::runtime_error("not ready");
+         }
+
+         return ok(1);
+      });
+
+      THEN("The exception propagates & the next access retries")
+      {
+         CHECK_THROWS_AS(value.borrow(), std::runtime_error);
+         CHECK_FALSE(value.is_evaluated());
+         REQUIRE(value.borrow().is_ok());
+         CHECK(value.borrow().borrow() == 1);
+         CHECK(calls == 2);
+      }
+   }
+}
+
+SCENARIO("lazy - deferred operations", "[lazy]")
+{
+   GIVEN("A lazy maybe")
+   {
+      int calls = 0;
+      lazy_maybe<int> value([&] {
+         ++calls;
+         return maybe(some(2));
+      });
+
+      WHEN("Operations are piped onto it")
+      {
+         int transforms = 0;
+         auto chained = std::move(value) | transform([&](int i) {
+                           ++transforms;
+                           return std::to_string(i * 2);
+                        }) |
+            and_then([](const std::string& s) {
+                           return s.empty() ? maybe<std::size_t>(none) : maybe(some(s.size()));
+                        });
+
+         THEN("Nothing is evaluated before the value is accessed")
+         {
+            STATIC_REQUIRE(std::is_same_v<decltype(chained), lazy_maybe<std::size_t>>);
+            CHECK(calls == 0);
+            CHECK(transforms == 0);
+         }
+         THEN("The whole chain runs once on access")
+         {
+            REQUIRE(chained.borrow().is_some());
+            CHECK(chained.borrow().borrow() == 1);
+            CHECK(calls == 1);
+            CHECK(transforms == 1);
+         }
+      }
+   }
+   GIVEN("A lazy result holding an error")
+   {
+      lazy_result<int, int> value([] {
+         return result<int, int>(err(3));
+      });
+
+      THEN("The error operations are deferred as well")
+      {
+         auto res = std::move(value) | transform_err([](int e) {
+                       return std::to_string(e);
+                    });
+
+         REQUIRE(res.borrow().is_err());
+         CHECK(res.borrow().borrow_err() == "3");
+      }
+   }
+   GIVEN("A lazy maybe piped through an operation that throws once")
+   {
+      int calls = 0;
+      lazy_maybe<std::string> value([&] {
+         ++calls;
+         return maybe(some(std::string(40, 'x'))); // NOLINT
+      });
+
+      int attempts = 0;
+      auto sized = std::move(value) | transform([&](const std::string& s) {
+                      if (attempts++ == 0)
+                      {
+                         throw std::runtime_error("not ready");
+                      }
+
+                      return std::size(s);
+                   });
+
+      THEN("The next access retries the operation on the same value")
+      {
+         CHECK_THROWS_AS(sized.borrow(), std::runtime_error);
+         CHECK_FALSE(sized.is_evaluated());
+         REQUIRE(sized.borrow().is_some());
+         CHECK(sized.borrow().borrow() == 40);
+         CHECK(calls == 1);
+         CHECK(attempts == 2);
+      }
+   }
+}
+
+SCENARIO("lazy - synchronized evaluation", "[lazy]")
+{
+   GIVEN("A synchronized lazy value shared by several threads")
+   {
+      std::atomic<int> calls = 0;
+      lazy<std::vector<int>, lazy_policy::synchronized> value([&] {
+         calls.fetch_add(1);
+         std::this_thread::sleep_for(std::chrono::milliseconds(10));
+         return std::vector<int>(100, 1);
+      });
+
+      THEN("The value is computed exactly once")
+      {
+         std::vector<std::thread> threads;
+         std::atomic<std::size_t> total = 0;
+
+         for (int i = 0; i < 8; ++i)
+         {
+            threads.emplace_back([&] {
+               total.fetch_add(value.borrow().size());
+            });
+         }
+
+         for (auto& thread : threads)
+         {
+            thread.join();
+         }
+
+         CHECK(calls.load() == 1);
+         CHECK(total.load() == 800);
+      }
+   }
+}
@@ -0,0 +1,257 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/atomic_maybe.hpp>
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/transform.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <thread>
+
+using namespace reglisse;
+
+namespace
+{
+   struct point
+   {
+      std::int16_t x;
+      std::int16_t y;
+   };
+
+   struct padded
+   {
+      std::int8_t tag;
+      std::int32_t value;
+   };
+
+   struct ticket
+   {
+      std::uint64_t id;
+   };
+
+   // clang-format off
+
+   template <typename T>
+   concept atomic_payload = requires
+   {
+      typename atomic_maybe<T>;
+   };
+
+   // clang-format on
+} // namespace
+
+template <>
+struct reglisse::atomic_maybe_niche<ticket>
+{
+   static constexpr ticket value = {.id = 0};
+};
+
+template <>
+struct reglisse::atomic_maybe_niche<double> : reglisse::signaling_nan_niche
+{
+};
+
+TEST_CASE("atomic_maybe - lock-free for small types", "[maybe][atomic_maybe]")
+{
+   STATIC_REQUIRE(atomic_maybe<std::int32_t>::is_always_lock_free);
+   STATIC_REQUIRE(atomic_maybe<point>::is_always_lock_free);
+   STATIC_REQUIRE(atomic_maybe<int*>::is_always_lock_free);
+}
+
+TEST_CASE("atomic_maybe - payloads of 8 bytes", "[maybe][atomic_maybe]")
+{
+   SECTION("Payloads with a niche are stored alone")
+   {
+      STATIC_REQUIRE(sizeof(atomic_maybe<double>) == 8);
+      STATIC_REQUIRE(sizeof(atomic_maybe<ticket>) == 8);
+      STATIC_REQUIRE(atomic_maybe<double>::is_always_lock_free);
+      STATIC_REQUIRE(atomic_maybe<ticket>::is_always_lock_free);
+
+      atomic_maybe<double> slot;
+      CHECK(slot.load().is_none());
+
+      slot.store(some(0.0));
+      REQUIRE(slot.load().is_some());
+      CHECK(slot.load().borrow() == 0.0);
+
+      maybe<double> expected = some(0.0);
+      CHECK(slot.compare_exchange_strong(expected, some(2.5)));
+      CHECK(slot.take().borrow() == 2.5);
+      CHECK(slot.load().is_none());
+
+      atomic_maybe<ticket> tickets(some(ticket{.id = 3}));
+      CHECK(tickets.take().borrow().id == 3);
+      CHECK(tickets.take().is_none());
+   }
+   SECTION("Other payloads take a 16 byte slot")
+   {
+      STATIC_REQUIRE(sizeof(atomic_maybe<std::uint64_t>) == 16);
+
+      atomic_maybe<std::uint64_t> slot(some(std::uint64_t{1} << 40U));
+
+      maybe<std::uint64_t> expected = none;
+      CHECK_FALSE(slot.compare_exchange_strong(expected, some(std::uint64_t{7})));
+      REQUIRE(expected.is_some());
+      CHECK(expected.borrow() == std::uint64_t{1} << 40U);
+
+      CHECK(slot.compare_exchange_strong(expected, some(std::uint64_t{7})));
+      CHECK(slot.exchange(none).borrow() == 7);
+      CHECK(slot.load().is_none());
+   }
+   SECTION("Payloads holding padding are refused")
+   {
+      STATIC_REQUIRE_FALSE(atomic_payload<padded>);
+   }
+}
+
+SCENARIO("atomic_maybe - single thread usage", "[maybe][atomic_maybe]")
+{
+   GIVEN("an empty slot")
+   {
+      atomic_maybe<int> slot;
+
+      THEN("loading it gives none") { CHECK(slot.load().is_none()); }
+      WHEN("a value is stored")
+      {
+         slot.store(some(10));
+
+         THEN("it can be loaded without emptying the slot")
+         {
+            REQUIRE(slot.load().is_some());
+            CHECK(slot.load().borrow() == 10);
+         }
+         THEN("taking it empties the slot")
+         {
+            const maybe<int> res = slot.take();
+
+            REQUIRE(res.is_some());
+            CHECK(res.borrow() == 10);
+            CHECK(slot.load().is_none());
+            CHECK(slot.take().is_none());
+         }
+         THEN("exchanging it gives back the previous value")
+         {
+            const maybe<int> res = slot.exchange(some(20));
+
+            REQUIRE(res.is_some());
+            CHECK(res.borrow() == 10);
+            CHECK(slot.load().borrow() == 20);
+         }
+         THEN("the taken value can be piped through operations")
+         {
+            const maybe res = slot.take() | transform([](int i) {
+                                 return i * 2;
+                              }) |
+               and_then([](int i) -> maybe<float> {
+                                 return some(static_cast<float>(i) / 4.0F);
+                              });
+
+            REQUIRE(res.is_some());
+            CHECK(res.borrow() == 5.0F);
+         }
+      }
+   }
+   GIVEN("a slot holding a value")
+   {
+      atomic_maybe<point> slot(some(point{.x = 1, .y = 2}));
+
+      WHEN("compare_exchange expects the wrong content")
+      {
+         maybe<point> expected = none;
+         const bool exchanged = slot.compare_exchange_strong(expected, some(point{.x = 3, .y = 4}));
+
+         THEN("the slot is left untouched and expected is updated")
+         {
+            CHECK_FALSE(exchanged);
+            REQUIRE(expected.is_some());
+            CHECK(expected.borrow().x == 1);
+            CHECK(expected.borrow().y == 2);
+            CHECK(slot.load().borrow().x == 1);
+         }
+      }
+      WHEN("compare_exchange expects the right content")
+      {
+         maybe<point> expected = some(point{.x = 1, .y = 2});
+         const bool exchanged = slot.compare_exchange_strong(expected, none);
+
+         THEN("the slot is replaced")
+         {
+            CHECK(exchanged);
+            CHECK(slot.load().is_none());
+         }
+      }
+   }
+   GIVEN("a slot of pointers")
+   {
+      int value = 5;
+      atomic_maybe<int*> slot;
+
+      slot.store(some(&value));
+
+      THEN("the pointer is published and taken back")
+      {
+         const maybe<int*> res = slot.take();
+
+         REQUIRE(res.is_some());
+         CHECK(res.borrow() == &value);
+         CHECK(slot.load().is_none());
+      }
+      THEN("compare_exchange works on the pointer")
+      {
+         maybe<int*> expected = some(&value);
+
+         CHECK(slot.compare_exchange_strong(expected, none));
+         CHECK(slot.load().is_none());
+      }
+      THEN("a failed compare_exchange with a release order reads the current pointer")
+      {
+         maybe<int*> expected = none;
+
+         CHECK_FALSE(slot.compare_exchange_strong(expected, none, std::memory_order_release));
+         REQUIRE(expected.is_some());
+         CHECK(expected.borrow() == &value);
+
+         expected = none;
+
+         CHECK_FALSE(slot.compare_exchange_weak(expected, none, std::memory_order_acq_rel));
+         REQUIRE(expected.is_some());
+         CHECK(expected.borrow() == &value);
+      }
+   }
+}
+
+TEST_CASE("atomic_maybe - producer/consumer handoff", "[maybe][atomic_maybe]")
+{
+   constexpr int count = 10'000;
+
+   atomic_maybe<int> slot;
+   std::int64_t sum = 0;
+
+   std::thread consumer([&] {
+      int received = 0;
+      while (received < count)
+      {
+         if (maybe<int> res = slot.take(std::memory_order_acquire); res.is_some())
+         {
+            sum += res.borrow();
+            ++received;
+         }
+      }
+   });
+
+   for (int i = 1; i <= count; ++i)
+   {
+      maybe<int> expected = none;
+      while (not slot.compare_exchange_weak(expected, some(i), std::memory_order_release,
+                                            std::memory_order_relaxed))
+      {
+         expected = none;
+      }
+   }
+
+   consumer.join();
+
+   CHECK(sum == std::int64_t{count} * (count + 1) / 2);
+   CHECK(slot.load().is_none());
+}
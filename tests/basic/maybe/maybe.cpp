@@ -1,9 +1,18 @@
 #define LIBREGLISSE_USE_EXCEPTIONS
+
+#include "../support/counted.hpp"
+
 #include <libreglisse/maybe.hpp>
 #include <libreglisse/operations/transform.hpp>
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <ranges>
+#include <string>
+#include <vector>
+
 using namespace reglisse;
 
 SCENARIO("maybe - construction", "[maybe]")
@@ -505,3 +514,118 @@ TEST_CASE("maybe - comparison", "[maybe]")
       }
    }
 }
+
+SCENARIO("maybe - assignment reuses storage", "[maybe]")
+{
+   GIVEN("two maybes holding a value")
+   {
+      maybe<test::counted> lhs = some(test::counted(1));
+      const maybe<test::counted> rhs = some(test::counted(2));
+
+      WHEN("they are copy and move assigned")
+      {
+         const auto measured = test::measure([&] {
+            lhs = rhs;
+            lhs = maybe<test::counted>(rhs);
+         });
+
+         THEN("the values are assigned in place")
+         {
+            CHECK(lhs.is_some());
+            CHECK(measured.copy_assignments == 1);
+            CHECK(measured.move_assignments == 1);
+            CHECK(measured.copies == 1);
+            CHECK(measured.moves == 0);
+         }
+      }
+   }
+   GIVEN("a maybe holding a long string")
+   {
+      maybe lhs = some(std::string(64, 'a'));
+      const maybe rhs = some(std::string(32, 'b'));
+
+      const char* buffer = lhs.borrow().data();
+
+      WHEN("a maybe holding a shorter string is copy assigned")
+      {
+         lhs = rhs;
+
+         THEN("the original buffer is reused")
+         {
+            REQUIRE(lhs.is_some());
+            CHECK(lhs.borrow() == std::string(32, 'b'));
+            CHECK(lhs.borrow().data() == buffer);
+         }
+      }
+   }
+   GIVEN("a maybe holding a value and an empty maybe")
+   {
+      maybe<std::string> full = some(std::string("hello"));
+      maybe<std::string> empty = none;
+
+      WHEN("the alternatives are switched through assignment")
+      {
+         maybe<std::string> copy_full = none;
+         copy_full = full;
+         full = empty;
+         empty = std::move(copy_full);
+
+         THEN("the content follows the assignments")
+         {
+            CHECK(full.is_none());
+            REQUIRE(empty.is_some());
+            CHECK(empty.borrow() == "hello");
+         }
+      }
+   }
+}
+
+SCENARIO("maybe - range of zero or one element", "[maybe]")
+{
+   GIVEN("a maybe holding a value and an empty maybe")
+   {
+      maybe<std::string> full = some(std::string("hello"));
+      const maybe<std::string> empty = none;
+
+      THEN("the monads are contiguous sized ranges")
+      {
+         STATIC_REQUIRE(std::ranges::contiguous_range<maybe<std::string>>);
+         STATIC_REQUIRE(std::ranges::sized_range<const maybe<std::string>>);
+         STATIC_REQUIRE(std::ranges::borrowed_range<decltype(full.view())>);
+
+         CHECK(std::ranges::size(full) == 1);
+         CHECK(std::ranges::empty(empty));
+         CHECK(full.begin() == &full.borrow());
+         CHECK(full.view().data() == &full.borrow());
+         CHECK(empty.view().empty());
+      }
+      THEN("range-based loops visit the value, if it exists")
+      {
+         for (std::string& value : full)
+         {
+            value += ", world";
+         }
+
+         int iterations = 0;
+         for ([[maybe_unused]] const std::string& value : empty)
+         {
+            ++iterations;
+         }
+
+         CHECK(full.borrow() == "hello, world");
+         CHECK(iterations == 0);
+      }
+   }
+   GIVEN("a vector of maybes")
+   {
+      const std::vector<maybe<int>> maybes = {some(1), none, some(2), none, some(3)};
+
+      THEN("joining the maybes yields the values")
+      {
+         std::vector<int> values;
+         std::ranges::copy(maybes | std::views::join, std::back_inserter(values));
+
+         CHECK(values == std::vector({1, 2, 3}));
+      }
+   }
+}
@@ -0,0 +1,359 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include "../support/counted.hpp"
+
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/or_else.hpp>
+#include <libreglisse/operations/transform.hpp>
+#include <libreglisse/operations/transform_err.hpp>
+#include <libreglisse/operations/transform_join_left.hpp>
+#include <libreglisse/operations/transform_join_right.hpp>
+#include <libreglisse/operations/transform_left.hpp>
+#include <libreglisse/operations/transform_right.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdlib>
+#include <new>
+#include <optional>
+
+using namespace reglisse;
+using namespace reglisse::test;
+
+auto operator new(std::size_t size) -> void*
+{
+   if (count_allocations)
+   {
+      ++counts.allocations;
+   }
+
+   if (void* ptr = std::malloc(size)) // NOLINT
+   {
+      return ptr;
+   }
+
+   throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept
+{
+   std::free(ptr); // NOLINT
+}
+void operator delete(void* ptr, std::size_t) noexcept
+{
+   std::free(ptr); // NOLINT
+}
+
+namespace
+{
+   enum struct category
+   {
+      lvalue,
+      const_lvalue,
+      rvalue
+   };
+
+   /**
+    * @brief The most special member calls an operation may make on its payloads & its callable.
+    */
+   struct bounds
+   {
+      std::size_t copies = 0;
+      std::size_t moves = 0;
+      std::size_t function_copies = 1;
+      std::size_t function_moves = 4;
+   };
+
+   /**
+    * @brief Pipe a copy of 'input' with the given value category into the closure made by
+    * 'make_closure', counting the closure creation & its application.
+    */
+   template <typename Monad, typename MakeClosure>
+   auto measure_pipe(category cat, const Monad& input, const MakeClosure& make_closure)
+      -> operation_counts
+   {
+      Monad m = input;
+
+      return measure([&] {
+         switch (cat)
+         {
+            case category::lvalue:
+               static_cast<void>(m | make_closure());
+               break;
+            case category::const_lvalue:
+               static_cast<void>(std::as_const(m) | make_closure());
+               break;
+            case category::rvalue:
+               static_cast<void>(std::move(m) | make_closure());
+               break;
+         }
+      });
+   }
+
+   void check_bounds(const operation_counts& measured, const bounds& expected)
+   {
+      CHECK(measured.copies <= expected.copies);
+      CHECK(measured.moves <= expected.moves);
+      CHECK(measured.copy_assignments == 0);
+      CHECK(measured.move_assignments == 0);
+      CHECK(measured.allocations == 0);
+      CHECK(measured.function_copies <= expected.function_copies);
+      CHECK(measured.function_moves <= expected.function_moves);
+
+      // Every payload made while measuring is destroyed before the measure ends.
+      CHECK(measured.constructions + measured.copies + measured.moves == measured.destructions);
+   }
+
+   /**
+    * @brief Check the bounds for every value category. Borrowed payloads may be copied where
+    * the operation must propagate them, rvalue payloads are only moved.
+    */
+   template <typename Monad, typename MakeClosure>
+   void check_categories(const Monad& input, const MakeClosure& make_closure,
+                         const bounds& borrowed, const bounds& taken)
+   {
+      check_bounds(measure_pipe(category::lvalue, input, make_closure), borrowed);
+      check_bounds(measure_pipe(category::const_lvalue, input, make_closure), borrowed);
+      check_bounds(measure_pipe(category::rvalue, input, make_closure), taken);
+   }
+
+   // A value produced by a callable is moved into 'some' or 'ok', then into the monad.
+   constexpr bounds produced = {.copies = 0, .moves = 2};
+   constexpr bounds produced_from_rvalue = {.copies = 0, .moves = 3};
+
+   // A propagated payload is copied or taken once, then moved into its helper & the monad.
+   constexpr bounds propagated = {.copies = 1, .moves = 1};
+   constexpr bounds propagated_from_rvalue = {.copies = 0, .moves = 3};
+
+   const auto next = counted_function([](const counted& c) {
+      return counted(c.value() + 1);
+   });
+} // namespace
+
+SCENARIO("accounting - maybe operations", "[accounting]")
+{
+   const auto some_next = counted_function([](const counted& c) -> maybe<counted> {
+      return some(counted(c.value() + 1));
+   });
+   const auto make_some = counted_function([]() -> maybe<counted> {
+      return some(counted(0));
+   });
+
+   GIVEN("A maybe holding a value")
+   {
+      const maybe<counted> m = some(counted(1));
+
+      THEN("transform moves the produced value")
+      {
+         check_categories(m, [&] { return transform(next); }, produced, produced_from_rvalue);
+      }
+      THEN("and_then only moves what its callable returns")
+      {
+         check_categories(m, [&] { return and_then(some_next); }, produced,
+                          produced_from_rvalue);
+      }
+      THEN("or_else propagates the value")
+      {
+         check_categories(m, [&] { return or_else(make_some); }, propagated,
+                          propagated_from_rvalue);
+      }
+   }
+   GIVEN("An empty maybe")
+   {
+      const maybe<counted> m = none;
+
+      THEN("transform & and_then touch no payload")
+      {
+         check_categories(m, [&] { return transform(next); }, {}, {});
+         check_categories(m, [&] { return and_then(some_next); }, {}, {});
+      }
+      THEN("or_else only moves what its callable returns")
+      {
+         check_categories(m, [&] { return or_else(make_some); }, produced, produced);
+      }
+   }
+}
+
+SCENARIO("accounting - standard library types", "[accounting]")
+{
+   GIVEN("A std::optional holding a value")
+   {
+      const std::optional<counted> opt(std::in_place, 1);
+
+      THEN("Adopting an lvalue copies its value once, adopting an rvalue moves it")
+      {
+         const auto from_lvalue = measure_pipe(category::lvalue, opt, [&] {
+            return transform(next);
+         });
+         const auto from_rvalue = measure_pipe(category::rvalue, opt, [&] {
+            return transform(next);
+         });
+
+         CHECK(from_lvalue.copies == 1);
+         CHECK(from_rvalue.copies == 0);
+         // The adopted maybe is a temporary, so the operation is applied to an rvalue.
+         check_bounds(from_lvalue, {.copies = 1, .moves = produced_from_rvalue.moves});
+         check_bounds(from_rvalue, {.copies = 0, .moves = produced_from_rvalue.moves + 1});
+      }
+   }
+}
+
+SCENARIO("accounting - result operations", "[accounting]")
+{
+   const auto ok_next = counted_function([](const counted& c) -> result<counted, counted> {
+      return ok(counted(c.value() + 1));
+   });
+
+   GIVEN("A result holding a value")
+   {
+      const result<counted, counted> r = ok(counted(1));
+
+      THEN("transform moves the produced value")
+      {
+         check_categories(r, [&] { return transform(next); }, produced, produced_from_rvalue);
+      }
+      THEN("transform_err propagates the value")
+      {
+         check_categories(r, [&] { return transform_err(next); }, propagated,
+                          propagated_from_rvalue);
+      }
+      THEN("and_then only moves what its callable returns")
+      {
+         check_categories(r, [&] { return and_then(ok_next); }, produced, produced_from_rvalue);
+      }
+      THEN("or_else propagates the value")
+      {
+         check_categories(r, [&] { return or_else(ok_next); }, propagated,
+                          propagated_from_rvalue);
+      }
+   }
+   GIVEN("A result holding an error")
+   {
+      const result<counted, counted> r = err(counted(1));
+
+      THEN("transform propagates the error")
+      {
+         check_categories(r, [&] { return transform(next); }, propagated,
+                          propagated_from_rvalue);
+      }
+      THEN("transform_err moves the produced error")
+      {
+         check_categories(r, [&] { return transform_err(next); }, produced,
+                          produced_from_rvalue);
+      }
+      THEN("and_then propagates the error")
+      {
+         check_categories(r, [&] { return and_then(ok_next); }, propagated,
+                          propagated_from_rvalue);
+      }
+      THEN("or_else only moves what its callable returns")
+      {
+         check_categories(r, [&] { return or_else(ok_next); }, produced, produced_from_rvalue);
+      }
+   }
+}
+
+SCENARIO("accounting - either operations", "[accounting]")
+{
+   const auto left_next = counted_function([](const counted& c) -> either<counted, counted> {
+      return left(counted(c.value() + 1));
+   });
+   const auto right_next = counted_function([](const counted& c) -> either<counted, counted> {
+      return right(counted(c.value() + 1));
+   });
+
+   GIVEN("An either holding a left value")
+   {
+      const either<counted, counted> e = left(counted(1));
+
+      THEN("transform_left moves the produced value")
+      {
+         check_categories(e, [&] { return transform_left(next); }, produced,
+                          produced_from_rvalue);
+      }
+      THEN("transform_right propagates the left value")
+      {
+         check_categories(e, [&] { return transform_right(next); }, propagated,
+                          propagated_from_rvalue);
+      }
+      THEN("transform_join_left only moves what its callable returns")
+      {
+         check_categories(e, [&] { return transform_join_left(left_next); }, produced,
+                          produced_from_rvalue);
+      }
+      THEN("transform_join_right propagates the left value")
+      {
+         check_categories(e, [&] { return transform_join_right(right_next); }, propagated,
+                          propagated_from_rvalue);
+      }
+   }
+   GIVEN("An either holding a right value")
+   {
+      const either<counted, counted> e = right(counted(1));
+
+      THEN("transform_left propagates the right value")
+      {
+         check_categories(e, [&] { return transform_left(next); }, propagated,
+                          propagated_from_rvalue);
+      }
+      THEN("transform_right moves the produced value")
+      {
+         check_categories(e, [&] { return transform_right(next); }, produced,
+                          produced_from_rvalue);
+      }
+      THEN("transform_join_left propagates the right value")
+      {
+         check_categories(e, [&] { return transform_join_left(left_next); }, propagated,
+                          propagated_from_rvalue);
+      }
+      THEN("transform_join_right only moves what its callable returns")
+      {
+         check_categories(e, [&] { return transform_join_right(right_next); }, produced,
+                          produced_from_rvalue);
+      }
+   }
+}
+
+SCENARIO("accounting - special members", "[accounting]")
+{
+   GIVEN("Monads holding counted payloads")
+   {
+      maybe<counted> m = some(counted(1));
+      result<counted, counted> r = err(counted(1));
+      either<counted, counted> e = left(counted(1));
+
+      THEN("Moving a monad moves its payload once")
+      {
+         CHECK(measure([&] { maybe<counted> moved(std::move(m)); }).moves == 1);
+         CHECK(measure([&] { result<counted, counted> moved(std::move(r)); }).moves == 1);
+         CHECK(measure([&] { either<counted, counted> moved(std::move(e)); }).moves == 1);
+      }
+      THEN("Copying a monad copies its payload once")
+      {
+         CHECK(measure([&] { maybe<counted> copied(m); }).copies == 1);
+         CHECK(measure([&] { result<counted, counted> copied(r); }).copies == 1);
+         CHECK(measure([&] { either<counted, counted> copied(e); }).copies == 1);
+      }
+      THEN("Building a monad from its helper moves the payload twice")
+      {
+         CHECK(measure([] { maybe<counted> built = some(counted(1)); }).moves <= 2);
+         CHECK(measure([] { result<counted, counted> built = ok(counted(1)); }).moves <= 2);
+         CHECK(measure([] { either<counted, counted> built = right(counted(1)); }).moves <= 2);
+      }
+   }
+   GIVEN("A callable passed directly to an operation")
+   {
+      const maybe<counted> m = some(counted(1));
+
+      THEN("The callable is not copied")
+      {
+         const auto measured = measure([&] { static_cast<void>(transform(m, next)); });
+
+         CHECK(measured.function_copies == 0);
+         CHECK(measured.function_moves == 0);
+      }
+   }
+}
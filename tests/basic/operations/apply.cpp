@@ -0,0 +1,118 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/apply.hpp>
+#include <libreglisse/operations/zip.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace reglisse;
+
+SCENARIO("Calling a function on `maybe` monads with `apply`", "[maybe][apply]")
+{
+   GIVEN("maybes that all hold a value")
+   {
+      const maybe a = maybe(some(2));
+      const maybe b = maybe(some(3));
+
+      THEN("the function is called with every value")
+      {
+         const maybe res = apply(
+            [](int x, int y) {
+               return x * y;
+            },
+            a, b);
+
+         REQUIRE(res.is_some());
+         CHECK(res.borrow() == 6);
+      }
+      THEN("a zipped maybe may be piped through 'apply'")
+      {
+         const maybe res = a | zip(b) | apply([](int x, int y) {
+                              return std::to_string(x + y);
+                           });
+
+         REQUIRE(res.is_some());
+         CHECK(res.borrow() == "5");
+      }
+   }
+   GIVEN("maybes where one is empty")
+   {
+      const maybe a = maybe(some(2));
+      const maybe<int> b = none;
+
+      THEN("the function is not called")
+      {
+         bool called = false;
+         const maybe res = apply(
+            [&](int x, int y) {
+               called = true;
+               return x + y;
+            },
+            a, b);
+
+         CHECK(res.is_none());
+         CHECK_FALSE(called);
+      }
+   }
+   GIVEN("maybes holding move only values")
+   {
+      THEN("the values are moved into the call")
+      {
+         const maybe res = apply(
+            [](std::unique_ptr<int> x, std::unique_ptr<int> y) {
+               return *x + *y;
+            },
+            maybe(some(std::make_unique<int>(1))), maybe(some(std::make_unique<int>(2))));
+
+         REQUIRE(res.is_some());
+         CHECK(res.borrow() == 3);
+      }
+   }
+}
+
+SCENARIO("Calling a function on `result` monads with `apply`", "[result][apply]")
+{
+   GIVEN("results that all hold a value")
+   {
+      const result<int, std::string> a = ok(2);
+      const result<int, std::string> b = ok(5);
+
+      THEN("the function is called with every value")
+      {
+         const result res = apply(
+            [](int x, int y) {
+               return x - y;
+            },
+            a, b);
+
+         REQUIRE(res.is_ok());
+         CHECK(res.borrow() == -3);
+      }
+   }
+   GIVEN("results where one holds an error")
+   {
+      const result<int, std::string> a = ok(2);
+      const result<int, std::string> b = err(std::string("invalid"));
+
+      THEN("the error is forwarded, with or without a zip")
+      {
+         const auto add = [](int x, int y) {
+            return x + y;
+         };
+
+         const result direct = apply(add, a, b);
+         const result piped = a | zip(b) | apply(add);
+
+         REQUIRE(direct.is_err());
+         CHECK(direct.borrow_err() == "invalid");
+         REQUIRE(piped.is_err());
+         CHECK(piped.borrow_err() == "invalid");
+      }
+   }
+}
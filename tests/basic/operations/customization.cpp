@@ -0,0 +1,259 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/or_else.hpp>
+#include <libreglisse/operations/transform.hpp>
+#include <libreglisse/operations/transform_err.hpp>
+#include <libreglisse/operations/transform_left.hpp>
+#include <libreglisse/operations/transform_right.hpp>
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+
+using namespace reglisse;
+
+namespace user
+{
+   /**
+    * @brief A maybe-like handle using -1 as its empty state.
+    */
+   class handle
+   {
+   public:
+      using value_type = int;
+
+   public:
+      constexpr handle() = default;
+      explicit constexpr handle(int value) : m_value(value) {}
+
+      [[nodiscard]] constexpr auto is_some() const noexcept -> bool { return m_value != -1; }
+      [[nodiscard]] constexpr auto is_none() const noexcept -> bool { return m_value == -1; }
+
+      [[nodiscard]] constexpr auto borrow() const -> const value_type& { return m_value; }
+      constexpr auto take() && -> value_type { return m_value; }
+
+   private:
+      int m_value = -1;
+   };
+
+   /**
+    * @brief A handle that keeps its own representation through 'transform'.
+    */
+   class packed_handle
+   {
+   public:
+      using value_type = int;
+
+   public:
+      constexpr packed_handle() = default;
+      explicit constexpr packed_handle(int value) : m_value(value) {}
+
+      [[nodiscard]] constexpr auto is_some() const noexcept -> bool { return m_value != -1; }
+      [[nodiscard]] constexpr auto is_none() const noexcept -> bool { return m_value == -1; }
+
+      constexpr auto take() && -> value_type { return m_value; }
+
+      template <std::invocable<int> Func>
+      friend constexpr auto tag_invoke(transform_fn, packed_handle h, Func&& func) -> packed_handle
+      {
+         if (h.is_some())
+         {
+            return packed_handle(std::invoke(std::forward<Func>(func), h.m_value));
+         }
+
+         return h;
+      }
+
+   private:
+      int m_value = -1;
+   };
+
+   /**
+    * @brief A result-like type storing an error code next to its value.
+    */
+   class status_or
+   {
+   public:
+      using value_type = int;
+      using error_type = int;
+
+   public:
+      static constexpr auto value(int value) -> status_or { return {value, 0}; }
+      static constexpr auto failure(int code) -> status_or { return {0, code}; }
+
+      [[nodiscard]] constexpr auto is_ok() const noexcept -> bool { return m_code == 0; }
+      [[nodiscard]] constexpr auto is_err() const noexcept -> bool { return m_code != 0; }
+
+      constexpr auto take() && -> value_type { return m_value; }
+      constexpr auto take_err() && -> error_type { return m_code; }
+
+   private:
+      constexpr status_or(int value, int code) : m_value(value), m_code(code) {}
+
+      int m_value;
+      int m_code;
+   };
+
+   /**
+    * @brief An either-like type of an int or a float.
+    */
+   class int_or_float
+   {
+   public:
+      using left_type = int;
+      using right_type = float;
+
+   public:
+      explicit constexpr int_or_float(int value) : m_left(value) {}
+      explicit constexpr int_or_float(float value) : m_is_left(false), m_right(value) {}
+
+      [[nodiscard]] constexpr auto is_left() const noexcept -> bool { return m_is_left; }
+      [[nodiscard]] constexpr auto is_right() const noexcept -> bool { return not m_is_left; }
+
+      constexpr auto take_left() && -> left_type { return m_left; }
+      constexpr auto take_right() && -> right_type { return m_right; }
+
+   private:
+      bool m_is_left = true;
+      int m_left = 0;
+      float m_right = 0.0F;
+   };
+} // namespace user
+
+static_assert(maybe_monad<user::handle>);
+static_assert(result_monad<user::status_or>);
+static_assert(either_monad<user::int_or_float>);
+
+SCENARIO("Operations on user defined maybe-like types", "[operations]")
+{
+   GIVEN("a handle holding a value")
+   {
+      const user::handle h{2};
+
+      WHEN("it is piped through 'transform' and 'and_then'")
+      {
+         const maybe res = h | transform([](int i) {
+                              return std::to_string(i);
+                           });
+         const maybe chained = user::handle(3) | and_then([](int i) -> maybe<int> {
+                                  return some(i * 2);
+                               });
+
+         THEN("libreglisse monads holding the results are produced")
+         {
+            REQUIRE(res.is_some());
+            CHECK(res.borrow() == "2");
+            REQUIRE(chained.is_some());
+            CHECK(chained.borrow() == 6);
+         }
+      }
+   }
+   GIVEN("an empty handle")
+   {
+      const user::handle h{};
+
+      WHEN("it is piped through 'transform' and 'or_else'")
+      {
+         const maybe res = h | transform([](int i) {
+                              return i + 1;
+                           });
+         const maybe recovered = user::handle() | or_else([] {
+                                    return maybe(some(10));
+                                 });
+
+         THEN("the transformation is skipped and the fallback used")
+         {
+            CHECK(res.is_none());
+            REQUIRE(recovered.is_some());
+            CHECK(recovered.borrow() == 10);
+         }
+      }
+   }
+   GIVEN("a handle customizing 'transform' through tag_invoke")
+   {
+      auto res = user::packed_handle(4) | transform([](int i) {
+                    return i * i;
+                 });
+
+      THEN("the user type is preserved")
+      {
+         STATIC_REQUIRE(std::same_as<decltype(res), user::packed_handle>);
+         CHECK(res.is_some());
+         CHECK(std::move(res).take() == 16);
+      }
+   }
+}
+
+SCENARIO("Operations on user defined result-like types", "[operations]")
+{
+   GIVEN("a status holding a value")
+   {
+      const result res = user::status_or::value(2) | transform([](int i) {
+                            return i * 2;
+                         });
+
+      THEN("the value is transformed")
+      {
+         REQUIRE(res.is_ok());
+         CHECK(res.borrow() == 4);
+      }
+   }
+   GIVEN("a status holding an error")
+   {
+      const result res = user::status_or::failure(5) | transform_err([](int code) {
+                            return std::to_string(code);
+                         });
+      const result recovered = user::status_or::failure(5) | or_else([](int code) {
+                                  return result<int, int>(ok(code * 10));
+                               });
+      const result chained = user::status_or::failure(5) | and_then([](int i) {
+                                return result<float, int>(ok(static_cast<float>(i)));
+                             });
+
+      THEN("the error follows the error path")
+      {
+         REQUIRE(res.is_err());
+         CHECK(res.borrow_err() == "5");
+         REQUIRE(recovered.is_ok());
+         CHECK(recovered.borrow() == 50);
+         REQUIRE(chained.is_err());
+         CHECK(chained.borrow_err() == 5);
+      }
+   }
+}
+
+SCENARIO("Operations on user defined either-like types", "[operations]")
+{
+   GIVEN("an either-like type holding a value on its left")
+   {
+      const either res = user::int_or_float(1) | transform_left([](int i) {
+                            return std::to_string(i);
+                         });
+      const either untouched = user::int_or_float(1) | transform_right([](float f) {
+                                  return f * 2.0F;
+                               });
+
+      THEN("only the left side is transformed")
+      {
+         REQUIRE(res.is_left());
+         CHECK(res.borrow_left() == "1");
+         REQUIRE(untouched.is_left());
+         CHECK(untouched.borrow_left() == 1);
+      }
+   }
+}
+
+TEST_CASE("operations - direct invocation", "[operations]")
+{
+   const maybe<int> m = some(1);
+
+   const maybe res = transform(m, [](int i) {
+      return i + 1;
+   });
+
+   REQUIRE(res.is_some());
+   CHECK(res.borrow() == 2);
+}
@@ -0,0 +1,179 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+#include <libreglisse/sum.hpp>
+
+#include <libreglisse/operations/match.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace reglisse;
+
+namespace
+{
+   /**
+    * @brief A result-like type without a 'match' member.
+    */
+   class status_or
+   {
+   public:
+      using value_type = int;
+      using error_type = int;
+
+   public:
+      static constexpr auto value(int value) -> status_or { return {value, 0}; }
+      static constexpr auto failure(int code) -> status_or { return {0, code}; }
+
+      [[nodiscard]] constexpr auto is_ok() const noexcept -> bool { return m_code == 0; }
+      [[nodiscard]] constexpr auto is_err() const noexcept -> bool { return m_code != 0; }
+
+      constexpr auto take() && -> value_type { return m_value; }
+      constexpr auto take_err() && -> error_type { return m_code; }
+
+   private:
+      constexpr status_or(int value, int code) : m_value(value), m_code(code) {}
+
+      int m_value;
+      int m_code;
+   };
+} // namespace
+
+SCENARIO("Matching on maybe monads", "[maybe]")
+{
+   GIVEN("A maybe holding a value & an empty maybe")
+   {
+      const maybe<int> full = some(2);
+      const maybe<int> empty = none;
+
+      THEN("The handler matching the state of the monad is called")
+      {
+         const auto on_some = [](int i) {
+            return std::to_string(i);
+         };
+         const auto on_none = [] {
+            return std::string("none");
+         };
+
+         CHECK((full | match(on_some, on_none)) == "2");
+         CHECK((empty | match(on_some, on_none)) == "none");
+         CHECK(full.match(on_some, on_none) == "2");
+      }
+   }
+   GIVEN("An rvalue maybe holding a move-only value")
+   {
+      maybe<std::unique_ptr<int>> m = some(std::make_unique<int>(3));
+
+      THEN("The value is moved into the handler")
+      {
+         const auto ptr = std::move(m) | match(
+                                            [](std::unique_ptr<int>&& p) {
+                                               return std::move(p);
+                                            },
+                                            [] {
+                                               return std::unique_ptr<int>();
+                                            });
+
+         REQUIRE(ptr);
+         CHECK(*ptr == 3);
+      }
+   }
+}
+
+SCENARIO("Matching on result monads", "[result]")
+{
+   GIVEN("Results holding a value & an error")
+   {
+      const result<int, std::string> good = ok(4);
+      result<int, std::string> bad = err(std::string("failure"));
+
+      THEN("The handlers share a common return type")
+      {
+         const auto on_ok = [](int i) -> long {
+            return i;
+         };
+         const auto on_err = [](const std::string& s) -> int {
+            return -static_cast<int>(s.size());
+         };
+
+         const auto good_res = good | match(on_ok, on_err);
+         const auto bad_res = match(bad, on_ok, on_err);
+
+         STATIC_REQUIRE(std::is_same_v<decltype(good_res), const long>);
+         CHECK(good_res == 4);
+         CHECK(bad_res == -7);
+      }
+      THEN("The error is moved out of an rvalue")
+      {
+         const auto message = std::move(bad) | match(
+                                                  [](int) {
+                                                     return std::string();
+                                                  },
+                                                  [](std::string&& s) {
+                                                     return std::move(s);
+                                                  });
+
+         CHECK(message == "failure");
+      }
+   }
+   GIVEN("A result-like type without a 'match' member")
+   {
+      THEN("The accessors of the type are used")
+      {
+         const auto on_ok = [](int i) {
+            return i;
+         };
+         const auto on_err = [](int code) {
+            return -code;
+         };
+
+         CHECK((status_or::value(3) | match(on_ok, on_err)) == 3);
+         CHECK((status_or::failure(2) | match(on_ok, on_err)) == -2);
+      }
+   }
+}
+
+SCENARIO("Matching on either & sum monads", "[either]")
+{
+   GIVEN("An either holding a value on its right")
+   {
+      const either<int, std::string> e = right("hello");
+
+      THEN("The right handler is called")
+      {
+         const auto size = e | match(
+                                  [](int) {
+                                     return std::size_t{0};
+                                  },
+                                  [](const std::string& s) {
+                                     return s.size();
+                                  });
+
+         CHECK(size == 5);
+      }
+   }
+   GIVEN("A sum")
+   {
+      const sum<int, char, std::string> s = at<1>('a');
+
+      THEN("The overload set of its alternatives is used")
+      {
+         const auto res = s | match(
+                                 [](int) {
+                                    return 0;
+                                 },
+                                 [](char) {
+                                    return 1;
+                                 },
+                                 [](const std::string&) {
+                                    return 2;
+                                 });
+
+         CHECK(res == 1);
+      }
+   }
+}
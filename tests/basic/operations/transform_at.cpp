@@ -0,0 +1,64 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/sum.hpp>
+
+#include <libreglisse/operations/transform_at.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace reglisse;
+
+SCENARIO("Transformation of a sum's alternative through pipes", "[sum]")
+{
+   GIVEN("A sum holding its second alternative")
+   {
+      const sum<int, std::string, double> s = at<1>("hello");
+      sum<int, std::string, double> moved = at<1>("hello");
+
+      THEN("`transform_at` on that alternative modifies the value stored")
+      {
+         const auto res = s | transform_at<1>([](const std::string& str) {
+                             return str.size();
+                          });
+
+         CHECK(std::is_same_v<std::remove_cvref_t<decltype(res)>, sum<int, std::size_t, double>>);
+         REQUIRE(res.is<1>());
+         CHECK(res.borrow<1>() == 5);
+
+         const auto appended = std::move(moved) | transform_at<1>([](std::string&& str) {
+                                  str.append(", world");
+                                  return std::move(str);
+                               });
+
+         REQUIRE(appended.is<1>());
+         CHECK(appended.borrow<1>() == "hello, world");
+      }
+      THEN("`transform_at` on another alternative carries the value over")
+      {
+         const auto res = transform_at<2>(s, [](double d) {
+            return static_cast<float>(d);
+         });
+
+         CHECK(std::is_same_v<std::remove_cvref_t<decltype(res)>, sum<int, std::string, float>>);
+         REQUIRE(res.is<1>());
+         CHECK(res.borrow<1>() == "hello");
+      }
+   }
+   GIVEN("A sum holding a move-only alternative")
+   {
+      sum<std::unique_ptr<int>, int> s = at<0>(std::make_unique<int>(2));
+
+      THEN("Transforming another alternative moves it over")
+      {
+         auto res = std::move(s) | transform_at<1>([](int i) {
+                       return i * 2;
+                    });
+
+         REQUIRE(res.is<0>());
+         CHECK(*res.borrow<0>() == 2);
+      }
+   }
+}
@@ -0,0 +1,87 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/zip.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <tuple>
+
+using namespace reglisse;
+
+SCENARIO("Combining `maybe` monads with `zip`", "[maybe][zip]")
+{
+   GIVEN("maybes that all hold a value")
+   {
+      const maybe a = maybe(some(1));
+      const maybe b = maybe(some(std::string("two")));
+
+      THEN("they can be zipped directly or through a pipe")
+      {
+         const maybe direct = zip(a, b, maybe(some(3.0F)));
+         const maybe piped = a | zip(b);
+
+         REQUIRE(direct.is_some());
+         CHECK(direct.borrow() == std::tuple(1, std::string("two"), 3.0F));
+         REQUIRE(piped.is_some());
+         CHECK(piped.borrow() == std::tuple(1, std::string("two")));
+         CHECK(b.borrow() == "two");
+      }
+   }
+   GIVEN("maybes where one is empty")
+   {
+      const maybe a = maybe(some(1));
+      const maybe<int> b = none;
+
+      THEN("the zipped maybe is empty") { CHECK(zip(a, b, a).is_none()); }
+   }
+   GIVEN("maybes holding move only values")
+   {
+      maybe a = maybe(some(std::make_unique<int>(1)));
+      maybe b = maybe(some(std::make_unique<int>(2)));
+
+      THEN("rvalues have their values moved into the tuple")
+      {
+         maybe res = zip(std::move(a), std::move(b));
+
+         REQUIRE(res.is_some());
+         CHECK(*std::get<0>(res.borrow()) == 1);
+         CHECK(*std::get<1>(res.borrow()) == 2);
+      }
+   }
+}
+
+SCENARIO("Combining `result` monads with `zip`", "[result][zip]")
+{
+   GIVEN("results that all hold a value")
+   {
+      const result<int, std::string> a = ok(1);
+      const result<float, std::string> b = ok(2.0F);
+
+      THEN("the values are zipped")
+      {
+         const result res = a | zip(b);
+
+         REQUIRE(res.is_ok());
+         CHECK(res.borrow() == std::tuple(1, 2.0F));
+      }
+   }
+   GIVEN("results where some hold an error")
+   {
+      const result<int, std::string> a = ok(1);
+      const result<int, std::string> b = err(std::string("first"));
+      const result<int, std::string> c = err(std::string("second"));
+
+      THEN("the first error is kept")
+      {
+         const result res = zip(a, b, c);
+
+         REQUIRE(res.is_err());
+         CHECK(res.borrow_err() == "first");
+      }
+   }
+}
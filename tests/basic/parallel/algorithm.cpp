@@ -0,0 +1,125 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/parallel/algorithm.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+SCENARIO("par_transform - over a range of maybes", "[parallel][par_transform]")
+{
+   thread_pool pool(3);
+
+   GIVEN("a large range of maybes")
+   {
+      std::vector<maybe<int>> input;
+      input.reserve(50'000);
+      for (int i = 0; i < 50'000; ++i)
+      {
+         input.push_back(i % 3 == 0 ? maybe<int>(none) : maybe<int>(some(i)));
+      }
+
+      WHEN("it is transformed in parallel")
+      {
+         const output_buffer res = par_transform(pool, input, [](int i) {
+            return std::to_string(i);
+         });
+
+         THEN("the output keeps the order of the input")
+         {
+            REQUIRE(res.size() == input.size());
+
+            bool matches = true;
+            for (std::size_t i = 0; i < res.size(); ++i)
+            {
+               const bool expected_some = i % 3 != 0;
+               matches = matches and res[i].is_some() == expected_some and
+                  (not expected_some or res[i].borrow() == std::to_string(i));
+            }
+
+            CHECK(matches);
+         }
+      }
+      WHEN("it is transformed in parallel into an existing range")
+      {
+         std::vector<maybe<long>> output(input.size(), none);
+
+         par_transform(pool, input, output, [](int i) {
+            return static_cast<long>(i) * 2;
+         });
+
+         THEN("every element is assigned in order")
+         {
+            CHECK(output[1].borrow() == 2);
+            CHECK(output[3].is_none());
+            CHECK(output[49'999].borrow() == 99'998);
+         }
+      }
+   }
+   GIVEN("an empty range")
+   {
+      const std::vector<maybe<int>> input;
+
+      const output_buffer res = par_transform(pool, input, [](int i) {
+         return i;
+      });
+
+      THEN("the output is empty") { CHECK(res.empty()); }
+   }
+}
+
+SCENARIO("par_and_then - over a range of results", "[parallel][par_and_then]")
+{
+   thread_pool pool(2);
+
+   GIVEN("a range of results")
+   {
+      std::vector<result<std::string, int>> input;
+      for (int i = 0; i < 10'000; ++i)
+      {
+         input.emplace_back(ok(std::to_string(i)));
+      }
+      input[42] = err(-1);
+
+      WHEN("a parser is applied in parallel")
+      {
+         const output_buffer res = par_and_then(pool, input, [](const std::string& s) {
+            const int value = std::stoi(s);
+
+            return value % 1000 == 999 ? result<int, int>(err(value))
+                                       : result<int, int>(ok(value));
+         });
+
+         THEN("the errors and values are in the input order")
+         {
+            REQUIRE(res.size() == input.size());
+            CHECK(res[0].borrow() == 0);
+            CHECK(res[42].borrow_err() == -1);
+            CHECK(res[999].borrow_err() == 999);
+            CHECK(res[9'998].borrow() == 9'998);
+         }
+      }
+      WHEN("the function throws")
+      {
+         auto run = [&] {
+            return par_and_then(pool, input, [](const std::string& s) -> result<std::string, int> {
+               if (s == "5000")
+               {
+                  throw std::runtime_error("failure");
+               }
+
+               return ok(s + s);
+            });
+         };
+
+         THEN("the exception is rethrown and the constructed results destroyed")
+         {
+            CHECK_THROWS_AS(run(), std::runtime_error);
+         }
+      }
+   }
+}
@@ -0,0 +1,171 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/parallel/partition.hpp>
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   auto make_results(std::size_t count) -> std::vector<result<std::string, int>>
+   {
+      std::vector<result<std::string, int>> res;
+      res.reserve(count);
+
+      for (std::size_t i = 0; i < count; ++i)
+      {
+         if (i % 7 == 3)
+         {
+            res.emplace_back(err(static_cast<int>(i)));
+         }
+         else
+         {
+            res.emplace_back(ok(std::to_string(i)));
+         }
+      }
+
+      return res;
+   }
+
+   // Not default constructible, counts the live instances & throws when copying 'poison'
+   struct payload
+   {
+      static constexpr int poison = 60'000;
+
+      inline static int alive = 0; // NOLINT
+
+      explicit payload(int v) : value(v) { ++alive; }
+      payload(const payload& other) : value(other.value)
+      {
+         if (value == poison)
+         {
+            throw std::runtime_error("poisoned payload");
+         }
+
+         ++alive;
+      }
+      payload(payload&& other) noexcept : value(other.value) { ++alive; }
+      ~payload() { --alive; }
+
+      auto operator=(const payload&) -> payload& = default;
+      auto operator=(payload&&) noexcept -> payload& = default;
+
+      int value;
+   };
+} // namespace
+
+SCENARIO("partition_results - streaming", "[parallel][partition_results]")
+{
+   GIVEN("a range of results")
+   {
+      const auto input = make_results(20);
+
+      WHEN("it is partitioned on the calling thread")
+      {
+         const auto res = partition_results(input);
+
+         THEN("values and indexed errors keep the order of the input")
+         {
+            REQUIRE(res.values.size() == 17);
+            REQUIRE(res.errors.size() == 3);
+            CHECK(res.values[0] == "0");
+            CHECK(res.values[3] == "4");
+            CHECK(res.errors[0] == std::pair<std::size_t, int>(3, 3));
+            CHECK(res.errors[2] == std::pair<std::size_t, int>(17, 17));
+         }
+         THEN("the input is left untouched") { CHECK(input[0].borrow() == "0"); }
+      }
+      WHEN("an rvalue range is partitioned")
+      {
+         auto owned = make_results(20);
+         const auto res = partition_results(std::move(owned));
+
+         THEN("the values are moved out") { CHECK(res.values[16] == "19"); }
+      }
+   }
+}
+
+SCENARIO("partition_results - parallel", "[parallel][partition_results]")
+{
+   thread_pool pool(3);
+
+   GIVEN("a large range of results")
+   {
+      const auto input = make_results(100'000);
+
+      WHEN("it is partitioned in parallel")
+      {
+         const auto res = partition_results(pool, input);
+         const auto expected = partition_results(input);
+
+         THEN("the output matches the streaming partition")
+         {
+            CHECK(res.values.size() + res.errors.size() == input.size());
+            CHECK(std::ranges::equal(res.values, expected.values));
+            CHECK(std::ranges::equal(res.errors, expected.errors));
+         }
+      }
+   }
+   GIVEN("a small range of results")
+   {
+      const auto input = make_results(10);
+
+      THEN("it is partitioned on the calling thread")
+      {
+         const auto res = partition_results(pool, input);
+
+         CHECK(res.values.size() == 9);
+         CHECK(res.errors.size() == 1);
+         CHECK(res.errors[0] == std::pair<std::size_t, int>(3, 3));
+      }
+   }
+   GIVEN("results holding a payload without a default constructor")
+   {
+      std::vector<result<payload, int>> input;
+      input.reserve(100'000);
+
+      for (int i = 0; i < 100'000; ++i)
+      {
+         if (i % 5 == 0)
+         {
+            input.emplace_back(err(i));
+         }
+         else
+         {
+            input.emplace_back(ok(payload(i)));
+         }
+      }
+
+      const int before = payload::alive;
+
+      THEN("the values are constructed in place")
+      {
+         {
+            const auto res = partition_results(pool, input);
+
+            REQUIRE(res.values.size() == 80'000);
+            REQUIRE(res.errors.size() == 20'000);
+            CHECK(res.values[0].value == 1);
+            CHECK(res.values[79'999].value == 99'999);
+            CHECK(payload::alive == before + 80'000);
+         }
+
+         CHECK(payload::alive == before);
+      }
+      THEN("a throwing construction destroys every value constructed")
+      {
+         input[payload::poison] = ok(payload(payload::poison));
+         const int replaced = payload::alive;
+
+         REQUIRE_THROWS_AS((partition_results(pool, input)), std::runtime_error);
+         CHECK(payload::alive == replaced);
+      }
+   }
+}
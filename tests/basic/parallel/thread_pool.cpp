@@ -0,0 +1,83 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/parallel/thread_pool.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using namespace reglisse;
+
+TEST_CASE("thread_pool - chunk range packing", "[parallel][thread_pool]")
+{
+   constexpr std::uint64_t range = detail::pack_chunk_range(3, 4'000'000'000);
+
+   STATIC_REQUIRE(detail::chunk_range_begin(range) == 3);
+   STATIC_REQUIRE(detail::chunk_range_end(range) == 4'000'000'000);
+   STATIC_REQUIRE(detail::clamp_chunk_size(10, 0) == 1);
+   STATIC_REQUIRE(detail::clamp_chunk_size(std::uint64_t{1} << 33U, 1) == 3);
+}
+
+SCENARIO("thread_pool - for_each_chunk", "[parallel][thread_pool]")
+{
+   GIVEN("a pool with a few workers")
+   {
+      thread_pool pool(3);
+
+      CHECK(pool.concurrency() == 4);
+
+      WHEN("a loop is run over many small chunks")
+      {
+         std::vector<std::atomic<int>> visits(10'000);
+
+         pool.for_each_chunk(visits.size(), 7, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i)
+            {
+               ++visits[i];
+            }
+         });
+
+         THEN("every element is visited exactly once")
+         {
+            bool all_once = true;
+            for (const auto& visit : visits)
+            {
+               all_once = all_once and visit.load() == 1;
+            }
+
+            CHECK(all_once);
+         }
+      }
+      WHEN("a loop is started from within a loop")
+      {
+         std::atomic<std::size_t> total = 0;
+
+         pool.for_each_chunk(8, 1, [&](std::size_t, std::size_t) {
+            pool.for_each_chunk(100, 10, [&](std::size_t begin, std::size_t end) {
+               total += end - begin;
+            });
+         });
+
+         THEN("the inner loops run serially to completion") { CHECK(total.load() == 800); }
+      }
+      WHEN("a chunk throws")
+      {
+         auto run = [&] {
+            pool.for_each_chunk(1'000, 1, [](std::size_t begin, std::size_t) {
+               if (begin == 500)
+               {
+                  throw std::runtime_error("failure");
+               }
+            });
+         };
+
+         THEN("the exception is rethrown to the caller")
+         {
+            CHECK_THROWS_AS(run(), std::runtime_error);
+         }
+      }
+   }
+}
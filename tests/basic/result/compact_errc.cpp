@@ -0,0 +1,132 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/compact_errc.hpp>
+#include <libreglisse/operations/transform_err.hpp>
+#include <libreglisse/result.hpp>
+#include <libreglisse/serialization.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <bit>
+#include <cerrno>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+using namespace reglisse;
+
+static_assert(sizeof(compact_errc) == 4);
+static_assert(sizeof(result<int, compact_errc>) == 8);
+static_assert(std::is_trivially_copyable_v<result<int, compact_errc>>);
+static_assert(not serializable<compact_errc>);
+static_assert(not serializable<result<int, compact_errc>>);
+
+namespace
+{
+   class parser_category : public std::error_category
+   {
+   public:
+      [[nodiscard]] auto name() const noexcept -> const char* override { return "parser"; }
+      [[nodiscard]] auto message(int code) const -> std::string override
+      {
+         return "parser error " + std::to_string(code);
+      }
+   };
+
+   auto get_parser_category() -> const std::error_category&
+   {
+      static const parser_category category;
+      return category;
+   }
+} // namespace
+
+SCENARIO("compact_errc - conversions", "[result][compact_errc]")
+{
+   GIVEN("Codes of the standard categories")
+   {
+      const std::error_code generic = std::make_error_code(std::errc::timed_out);
+      const std::error_code system(ECONNREFUSED, std::system_category());
+
+      THEN("They round trip through compact_errc")
+      {
+         const maybe<compact_errc> packed_generic = compact_errc::from(generic);
+         const maybe<compact_errc> packed_system = compact_errc::from(system);
+
+         REQUIRE(packed_generic.is_some());
+         REQUIRE(packed_system.is_some());
+         CHECK(packed_generic.borrow().to_error_code() == generic);
+         CHECK(packed_system.borrow().to_error_code() == system);
+         CHECK(packed_generic.borrow() == compact_errc(std::errc::timed_out));
+         CHECK(packed_system.borrow().message() == system.message());
+      }
+      THEN("They convert to & from errno")
+      {
+         CHECK(compact_errc::from_errno(ETIMEDOUT).borrow() == compact_errc(std::errc::timed_out));
+         CHECK(compact_errc(std::errc::timed_out).to_errno() == ETIMEDOUT);
+      }
+      THEN("Negative codes keep their sign")
+      {
+         const std::error_code negative(-42, std::system_category());
+
+         CHECK(compact_errc::from(negative).borrow().value() == -42);
+      }
+   }
+   GIVEN("Codes that do not fit or belong to another category")
+   {
+      const std::error_code large(1 << 24, std::system_category()); // NOLINT
+      const std::error_code custom(3, get_parser_category());
+
+      THEN("Codes too large are refused")
+      {
+         CHECK(compact_errc::from(large).is_none());
+         CHECK(compact_errc::from_errno(compact_errc::max_value + 1).is_none());
+      }
+      THEN("Other categories are registered once")
+      {
+         const maybe<compact_errc> first = compact_errc::from(custom);
+         const maybe<compact_errc> second = compact_errc::from(custom);
+
+         REQUIRE(first.is_some());
+         CHECK(first == second);
+         CHECK(first.borrow().category_id() > 1);
+         CHECK(first.borrow().to_error_code() == custom);
+         CHECK(first.borrow().message() == "parser error 3");
+         CHECK(first.borrow().to_errno().is_none());
+      }
+   }
+   GIVEN("Bits copied from elsewhere holding a category id unknown to this process")
+   {
+      constexpr std::uint32_t unregistered_id = 250;
+      constexpr std::uint32_t bits = (5U << 8U) | unregistered_id; // NOLINT
+
+      const auto code = std::bit_cast<compact_errc>(bits);
+
+      THEN("It reports the unknown category instead of crashing")
+      {
+         CHECK(code.value() == 5);
+         CHECK(code.category_id() == unregistered_id);
+         CHECK(std::string(code.category().name()) == "unknown");
+         CHECK(code.message() == "unknown error category");
+         CHECK(code.to_error_code().value() == 5);
+         CHECK(code.to_errno().is_none());
+      }
+   }
+}
+
+SCENARIO("compact_errc - results", "[result][compact_errc]")
+{
+   GIVEN("A result holding a system error")
+   {
+      const result<int, compact_errc> r =
+         err(compact_errc::from(std::error_code(ECONNREFUSED, std::system_category())).take());
+
+      THEN("transform_err maps it to the generic category")
+      {
+         const auto mapped = r | transform_err([](compact_errc e) { return e.to_generic(); });
+
+         REQUIRE(mapped.is_err());
+         CHECK(mapped.borrow_err() == compact_errc(std::errc::connection_refused));
+      }
+   }
+}
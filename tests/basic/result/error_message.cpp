@@ -0,0 +1,187 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include "../support/counted.hpp"
+
+#include <libreglisse/error_message.hpp>
+#include <libreglisse/result.hpp>
+#include <libreglisse/serialization.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace reglisse;
+
+static_assert(sizeof(err_literal) == sizeof(std::string_view));
+static_assert(sizeof(interned_msg) == 4);
+static_assert(sizeof(result<int, interned_msg>) == 8);
+static_assert(std::is_trivially_copyable_v<result<int, interned_msg>>);
+
+static_assert(not serializable<err_literal>);
+static_assert(not serializable<interned_msg>);
+static_assert(not serializable<result<int, interned_msg>>);
+
+namespace
+{
+   auto parse_digit(char c) -> result<int, err_literal>
+   {
+      if (c < '0' or c > '9')
+      {
+         return static_err("not a digit");
+      }
+
+      return ok(c - '0');
+   }
+} // namespace
+
+SCENARIO("err_literal - construction", "[result][error_message]")
+{
+   GIVEN("A function failing with a string literal")
+   {
+      THEN("The error refers to the literal")
+      {
+         const result<int, err_literal> res = parse_digit('x');
+
+         REQUIRE(res.is_err());
+         CHECK(res.borrow_err().view() == "not a digit");
+         CHECK(std::string_view(res.borrow_err().c_str()) == "not a digit");
+         CHECK(res.borrow_err() == err_literal("not a digit"));
+         CHECK(std::hash<err_literal>()(res.borrow_err()) ==
+               std::hash<std::string_view>()("not a digit"));
+      }
+      THEN("The message is sized from the literal")
+      {
+         static constexpr char message[] = {'a', '\0', 'b', '\0'}; // NOLINT
+
+         constexpr err_literal literal(message);
+
+         STATIC_REQUIRE(literal.view() == std::string_view("a\0b", 3));
+      }
+      THEN("Failing does not allocate")
+      {
+         const auto measured = test::measure([] {
+            const result<int, err_literal> res = parse_digit('x');
+            CHECK(res.is_err());
+         });
+
+         CHECK(measured.allocations == 0);
+      }
+   }
+}
+
+SCENARIO("interned_msg - interning", "[result][error_message]")
+{
+   GIVEN("The empty message")
+   {
+      THEN("It has id 0 & is the default")
+      {
+         CHECK(interned_msg().id() == 0);
+         CHECK(intern("").id() == 0);
+         CHECK(interned_msg().view().empty());
+      }
+   }
+   GIVEN("An id that was never interned in this process")
+   {
+      const auto unknown = std::bit_cast<interned_msg>(std::uint32_t{0xFFFF'FFF0});
+
+      THEN("It has the empty message")
+      {
+         CHECK(unknown.view().empty());
+      }
+   }
+   GIVEN("Messages built at runtime")
+   {
+      const std::string path = "/etc/reglisse/config";
+      const std::string message = "could not open " + path;
+
+      THEN("Equal messages share the same id")
+      {
+         const interned_msg first = intern(message);
+         const interned_msg second = intern(std::string("could not open ") + path);
+         const interned_msg other = intern("could not read " + path);
+
+         CHECK(first.id() != 0);
+         CHECK(first == second);
+         CHECK(first != other);
+         CHECK(first.view() == message);
+         CHECK(other.view() == "could not read " + path);
+         CHECK(std::hash<interned_msg>()(first) == std::hash<interned_msg>()(second));
+      }
+      THEN("Interning a known message does not allocate")
+      {
+         const interned_msg first = intern(message);
+         const std::string_view view = message;
+
+         const auto measured = test::measure([&] {
+            const result<int, interned_msg> res = err(intern(view));
+            CHECK(res.borrow_err() == first);
+         });
+
+         CHECK(measured.allocations == 0);
+      }
+   }
+   GIVEN("Many messages")
+   {
+      std::vector<std::string> messages;
+      for (int i = 0; i < 1000; ++i) // NOLINT
+      {
+         messages.push_back("message number " + std::to_string(i));
+      }
+
+      THEN("Each keeps its own id & view")
+      {
+         std::vector<interned_msg> interned;
+         for (const auto& message : messages)
+         {
+            interned.push_back(intern(message));
+         }
+
+         for (std::size_t i = 0; i < std::size(messages); ++i)
+         {
+            CHECK(interned[i].view() == messages[i]);
+            CHECK(intern(messages[i]) == interned[i]);
+         }
+      }
+   }
+   GIVEN("Threads interning the same messages")
+   {
+      const std::vector<std::string> messages = {"timed out", "connection refused",
+                                                 "host unreachable", "broken pipe"};
+
+      THEN("They all agree on the ids")
+      {
+         std::vector<std::vector<interned_msg>> ids(4); // NOLINT
+         std::vector<std::thread> threads;
+         for (auto& thread_ids : ids)
+         {
+            threads.emplace_back([&] {
+               for (int i = 0; i < 100; ++i) // NOLINT
+               {
+                  for (const auto& message : messages)
+                  {
+                     thread_ids.push_back(intern(message));
+                  }
+               }
+            });
+         }
+
+         for (auto& thread : threads)
+         {
+            thread.join();
+         }
+
+         for (const auto& thread_ids : ids)
+         {
+            CHECK(thread_ids == ids.front());
+         }
+         CHECK(ids.front()[1].view() == "connection refused");
+      }
+   }
+}
@@ -1,9 +1,12 @@
 #define LIBREGLISSE_USE_EXCEPTIONS
 
+#include "../support/counted.hpp"
+
 #include <libreglisse/result.hpp>
 
 #include <catch2/catch.hpp>
 
+#include <string>
 #include <vector>
 
 using namespace reglisse;
@@ -218,3 +221,50 @@ SCENARIO("result - taking", "[result]")
       }
    }
 }
+
+SCENARIO("result - assignment reuses storage", "[result]")
+{
+   GIVEN("two results holding the same alternative")
+   {
+      result<test::counted, int> lhs = ok(test::counted(1));
+      const result<test::counted, int> rhs = ok(test::counted(2));
+
+      WHEN("they are copy and move assigned")
+      {
+         const auto measured = test::measure([&] {
+            lhs = rhs;
+            lhs = result<test::counted, int>(rhs);
+         });
+
+         THEN("the alternative is assigned in place")
+         {
+            CHECK(lhs.is_ok());
+            CHECK(measured.copy_assignments == 1);
+            CHECK(measured.move_assignments == 1);
+            CHECK(measured.copies == 1);
+            CHECK(measured.moves == 0);
+         }
+      }
+   }
+   GIVEN("two results holding different alternatives")
+   {
+      result<std::string, int> lhs = ok(std::string("hello"));
+      const result<std::string, int> rhs = err(1);
+
+      WHEN("the alternatives are switched through assignment")
+      {
+         result<std::string, int> other = err(2);
+
+         lhs = rhs;
+         other = result<std::string, int>(ok(std::string("world")));
+
+         THEN("the content follows the assignments")
+         {
+            REQUIRE(lhs.is_err());
+            CHECK(lhs.borrow_err() == 1);
+            REQUIRE(other.is_ok());
+            CHECK(other.borrow() == "world");
+         }
+      }
+   }
+}
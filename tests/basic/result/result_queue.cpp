@@ -0,0 +1,192 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/result_queue.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace reglisse;
+
+SCENARIO("spsc_result_queue - single thread usage", "[result][result_queue]")
+{
+   GIVEN("an empty queue")
+   {
+      spsc_result_queue<std::string, int> queue(3, 2);
+
+      THEN("the capacities are rounded up to a power of two")
+      {
+         CHECK(queue.capacity() == 4);
+         CHECK(queue.error_capacity() == 2);
+      }
+      THEN("nothing can be popped")
+      {
+         CHECK(queue.try_pop().is_none());
+         CHECK(queue.try_pop_err().is_none());
+      }
+      WHEN("values and errors are pushed")
+      {
+         CHECK(queue.try_push(ok(std::string("a"))));
+         CHECK(queue.try_push(err(1)));
+         CHECK(queue.try_push(ok(std::string("b"))));
+         CHECK(queue.try_push(ok(std::string("c"))));
+         CHECK(queue.try_push(err(2)));
+
+         THEN("values are drained in batches, in order")
+         {
+            std::array<std::string, 2> out;
+
+            CHECK(queue.pop_n(out) == 2);
+            CHECK(out[0] == "a");
+            CHECK(out[1] == "b");
+            CHECK(queue.pop_n(out) == 1);
+            CHECK(out[0] == "c");
+            CHECK(queue.pop_n(out) == 0);
+         }
+         THEN("errors are tagged with the number of values pushed before them")
+         {
+            const maybe first = queue.try_pop_err();
+            const maybe second = queue.try_pop_err();
+
+            REQUIRE(first.is_some());
+            CHECK(first.borrow() == std::pair<std::size_t, int>(1, 1));
+            REQUIRE(second.is_some());
+            CHECK(second.borrow() == std::pair<std::size_t, int>(3, 2));
+         }
+      }
+      WHEN("a lane is full")
+      {
+         CHECK(queue.try_push(err(1)));
+         CHECK(queue.try_push(err(2)));
+
+         result<std::string, int> res = err(3);
+
+         THEN("the push fails without consuming the result")
+         {
+            CHECK_FALSE(queue.try_push(res));
+            REQUIRE(res.is_err());
+            CHECK(res.borrow_err() == 3);
+            CHECK(queue.try_push(ok(std::string("value"))));
+         }
+      }
+   }
+}
+
+TEST_CASE("spsc_result_queue - producer/consumer", "[result][result_queue]")
+{
+   constexpr std::int64_t count = 20'000;
+
+   spsc_result_queue<std::int64_t, std::int64_t> queue(64);
+
+   std::thread producer([&] {
+      for (std::int64_t i = 0; i < count; ++i)
+      {
+         result<std::int64_t, std::int64_t> res = i % 10 == 0
+            ? result<std::int64_t, std::int64_t>(err(i))
+            : result<std::int64_t, std::int64_t>(ok(i));
+
+         while (not queue.try_push(res)) {}
+      }
+   });
+
+   std::int64_t value_sum = 0;
+   std::int64_t error_sum = 0;
+   std::int64_t received = 0;
+   std::array<std::int64_t, 16> batch{};
+
+   while (received < count)
+   {
+      const std::size_t popped = queue.pop_n(batch);
+      for (std::size_t i = 0; i < popped; ++i)
+      {
+         value_sum += batch[i];
+      }
+
+      received += static_cast<std::int64_t>(popped);
+
+      while (true)
+      {
+         const maybe entry = queue.try_pop_err();
+         if (entry.is_none())
+         {
+            break;
+         }
+
+         error_sum += entry.borrow().second;
+         ++received;
+      }
+   }
+
+   producer.join();
+
+   CHECK(value_sum + error_sum == count * (count - 1) / 2);
+   CHECK(error_sum == 10 * ((count / 10) * (count / 10 - 1) / 2));
+}
+
+TEST_CASE("mpmc_result_queue - multiple producers and consumers", "[result][result_queue]")
+{
+   constexpr std::int64_t per_producer = 5'000;
+   constexpr int producer_count = 2;
+   constexpr int consumer_count = 2;
+
+   mpmc_result_queue<std::int64_t, int> queue(32);
+
+   std::atomic<std::int64_t> value_sum = 0;
+   std::atomic<std::int64_t> error_count = 0;
+   std::atomic<std::int64_t> received = 0;
+
+   std::vector<std::thread> threads;
+   for (int p = 0; p < producer_count; ++p)
+   {
+      threads.emplace_back([&] {
+         for (std::int64_t i = 1; i <= per_producer; ++i)
+         {
+            result<std::int64_t, int> res = i % 100 == 0 ? result<std::int64_t, int>(err(-1))
+                                                         : result<std::int64_t, int>(ok(i));
+
+            while (not queue.try_push(res)) {}
+         }
+      });
+   }
+   for (int c = 0; c < consumer_count; ++c)
+   {
+      threads.emplace_back([&] {
+         std::array<std::int64_t, 8> batch{};
+
+         while (received.load() < per_producer * producer_count)
+         {
+            const std::size_t popped = queue.pop_n(batch);
+            for (std::size_t i = 0; i < popped; ++i)
+            {
+               value_sum += batch[i];
+            }
+
+            received += static_cast<std::int64_t>(popped);
+
+            if (queue.try_pop_err().is_some())
+            {
+               ++error_count;
+               ++received;
+            }
+         }
+      });
+   }
+
+   for (auto& thread : threads)
+   {
+      thread.join();
+   }
+
+   const std::int64_t expected_errors = producer_count * (per_producer / 100);
+   const std::int64_t error_values = producer_count * 100 * (per_producer / 100) *
+      (per_producer / 100 + 1) / 2;
+
+   CHECK(error_count.load() == expected_errors);
+   CHECK(value_sum.load() ==
+         producer_count * per_producer * (per_producer + 1) / 2 - error_values);
+}
@@ -0,0 +1,236 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/column_file.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   enum struct failure : std::uint16_t
+   {
+      timeout = 7,
+      refused = 9
+   };
+
+   /**
+    * @brief A file in the temporary directory, removed on destruction.
+    */
+   class temporary_file
+   {
+   public:
+      explicit temporary_file(const std::string& name) :
+         m_path(std::filesystem::temp_directory_path() / name)
+      {}
+      temporary_file(const temporary_file&) = delete;
+      temporary_file(temporary_file&&) = delete;
+      ~temporary_file() { std::filesystem::remove(m_path); }
+
+      auto operator=(const temporary_file&) -> temporary_file& = delete;
+      auto operator=(temporary_file&&) -> temporary_file& = delete;
+
+      [[nodiscard]] auto path() const -> const std::filesystem::path& { return m_path; }
+
+   private:
+      std::filesystem::path m_path;
+   };
+} // namespace
+
+SCENARIO("column file - maybe columns", "[serialization][column_file]")
+{
+   GIVEN("A column of maybes written to a file")
+   {
+      std::vector<maybe<std::int64_t>> values;
+      for (std::int64_t i = 0; i < 1000; ++i)
+      {
+         values.push_back(i % 5 == 0 ? maybe<std::int64_t>(none) : some(i * 3));
+      }
+
+      const temporary_file file("libreglisse_maybe_column.bin");
+      {
+         std::ofstream os(file.path(), std::ios::binary);
+         write_column(os, std::span<const maybe<std::int64_t>>(values));
+      }
+
+      THEN("The mapped column reads back every element")
+      {
+         const auto column = mapped_column<maybe<std::int64_t>>::open(file.path());
+         REQUIRE(column.is_ok());
+         REQUIRE(column.borrow().size() == std::size(values));
+
+         CHECK(std::ranges::equal(column.borrow(), values));
+         CHECK(column.borrow()[999] == values[999]);
+      }
+      THEN("It is a random access range")
+      {
+         STATIC_REQUIRE(std::ranges::random_access_range<mapped_column<maybe<std::int64_t>>>);
+         STATIC_REQUIRE(std::ranges::sized_range<mapped_column<maybe<std::int64_t>>>);
+
+         const auto column = mapped_column<maybe<std::int64_t>>::open(file.path(),
+                                                                     access_hint::random);
+         REQUIRE(column.is_ok());
+
+         auto it = std::begin(column.borrow()) + 123;
+         CHECK(*it == values[123]);
+         CHECK(it[-23] == values[100]);
+         CHECK(std::end(column.borrow()) - it == 877);
+      }
+      THEN("Opening it as another monad fails")
+      {
+         const auto as_result = mapped_column<result<std::int64_t, failure>>::open(file.path());
+         const auto as_int = mapped_column<maybe<std::int32_t>>::open(file.path());
+
+         REQUIRE(as_result.is_err());
+         CHECK(as_result.borrow_err() == column_error::type_mismatch);
+         REQUIRE(as_int.is_err());
+         CHECK(as_int.borrow_err() == column_error::type_mismatch);
+      }
+   }
+}
+
+SCENARIO("column file - result columns", "[serialization][column_file]")
+{
+   GIVEN("A column of results with sparse errors spanning several rank blocks")
+   {
+      std::vector<result<std::uint32_t, failure>> values;
+      for (std::uint32_t i = 0; i < 3000; ++i)
+      {
+         if (i % 97 == 5)
+         {
+            values.emplace_back(err(i % 2 == 0 ? failure::timeout : failure::refused));
+         }
+         else
+         {
+            values.emplace_back(ok(i));
+         }
+      }
+
+      const temporary_file file("libreglisse_result_column.bin");
+      {
+         std::ofstream os(file.path(), std::ios::binary);
+         write_column(os, std::span<const result<std::uint32_t, failure>>(values));
+      }
+
+      const auto column = mapped_column<result<std::uint32_t, failure>>::open(
+         file.path(), access_hint::sequential);
+      REQUIRE(column.is_ok());
+
+      THEN("Iterating reads back every value & error")
+      {
+         CHECK(column.borrow().view().error_count() == 31);
+         CHECK(std::ranges::equal(column.borrow(), values));
+      }
+      THEN("Indexing finds errors through the rank index")
+      {
+         for (std::size_t i = 0; i < std::size(values); i += 97)
+         {
+            CHECK(column.borrow()[i + 5] == values[i + 5]);
+            CHECK(column.borrow()[i] == values[i]);
+         }
+      }
+      THEN("Iterators moved backward & forward keep track of the errors")
+      {
+         auto it = std::end(column.borrow());
+         --it;
+         CHECK(*it == values.back());
+
+         it -= 1000;
+         CHECK(*it == values[1999]);
+
+         for (std::size_t i = 1999; i > 1900; --i, --it)
+         {
+            REQUIRE(*it == values[i]);
+         }
+      }
+   }
+}
+
+SCENARIO("column file - malformed files", "[serialization][column_file]")
+{
+   GIVEN("Files that hold no column")
+   {
+      const temporary_file missing("libreglisse_missing_column.bin");
+      const temporary_file garbage("libreglisse_garbage_column.bin");
+      const temporary_file truncated("libreglisse_truncated_column.bin");
+
+      {
+         std::ofstream os(garbage.path(), std::ios::binary);
+         os << std::string(128, 'x');
+      }
+      {
+         const std::vector<maybe<std::int64_t>> values(100, some(std::int64_t{1}));
+
+         std::ostringstream encoded;
+         write_column(encoded, std::span<const maybe<std::int64_t>>(values));
+
+         const std::string bytes = encoded.str();
+
+         std::ofstream os(truncated.path(), std::ios::binary);
+         os << bytes.substr(0, std::size(bytes) - 8);
+      }
+
+      THEN("Opening them reports why")
+      {
+         CHECK(mapped_column<maybe<std::int64_t>>::open(missing.path()).borrow_err() ==
+               column_error::open_failed);
+         CHECK(mapped_column<maybe<std::int64_t>>::open(garbage.path()).borrow_err() ==
+               column_error::invalid_magic);
+         CHECK(mapped_column<maybe<std::int64_t>>::open(truncated.path()).borrow_err() ==
+               column_error::truncated);
+      }
+   }
+   GIVEN("Columns of results whose counts were overwritten")
+   {
+      std::vector<result<std::uint32_t, failure>> values;
+      for (std::uint32_t i = 0; i < 1000; ++i)
+      {
+         values.emplace_back(i % 3 == 0 ? result<std::uint32_t, failure>(err(failure::timeout))
+                                        : result<std::uint32_t, failure>(ok(i)));
+      }
+
+      std::ostringstream encoded;
+      write_column(encoded, std::span<const result<std::uint32_t, failure>>(values));
+
+      const std::string bytes = encoded.str();
+
+      // The error count follows the element count, the padded bitmap & the values.
+      const std::size_t error_count_offset = column_header_size + 8 + 128 + 1000 * 4;
+      const std::string zero(8, '\0');
+
+      std::string bad_count = bytes;
+      bad_count.replace(error_count_offset, std::size(zero), zero);
+
+      std::string bad_rank_index = bytes;
+      bad_rank_index.replace(std::size(bytes) - 8, std::size(zero), zero);
+
+      const temporary_file count_file("libreglisse_bad_count_column.bin");
+      const temporary_file rank_file("libreglisse_bad_rank_column.bin");
+      {
+         std::ofstream os(count_file.path(), std::ios::binary);
+         os << bad_count;
+      }
+      {
+         std::ofstream os(rank_file.path(), std::ios::binary);
+         os << bad_rank_index;
+      }
+
+      THEN("Opening them reports the corruption")
+      {
+         using column = mapped_column<result<std::uint32_t, failure>>;
+
+         CHECK(column::open(count_file.path()).borrow_err() == column_error::corrupted);
+         CHECK(column::open(rank_file.path()).borrow_err() == column_error::corrupted);
+      }
+   }
+}
@@ -0,0 +1,285 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/serialization.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   struct point
+   {
+      std::int32_t x;
+      std::int32_t y;
+
+      auto operator==(const point&) const -> bool = default;
+   };
+
+   enum struct failure : std::uint16_t
+   {
+      timeout = 7,
+      refused = 9
+   };
+} // namespace
+
+SCENARIO("serialization - single monads", "[serialization]")
+{
+   GIVEN("Maybes of trivially copyable payloads")
+   {
+      const maybe<point> full = some(point{.x = 1, .y = -2});
+      const maybe<point> empty = none;
+
+      THEN("They are encoded as a tag byte followed by the payload")
+      {
+         std::vector<std::byte> buffer;
+         encode(buffer, full);
+         encode(buffer, empty);
+
+         REQUIRE(std::size(buffer) == 1 + sizeof(point) + 1);
+         CHECK(buffer[0] == std::byte{1});
+         CHECK(buffer[1 + sizeof(point)] == std::byte{0});
+
+         const auto first = decode<maybe<point>>(buffer);
+         REQUIRE(first.is_ok());
+         CHECK(first.borrow() == full);
+
+         const auto second = decode<maybe<point>>(std::span(buffer).subspan(1 + sizeof(point)));
+         REQUIRE(second.is_ok());
+         CHECK(second.borrow().is_none());
+      }
+      THEN("Views read them in place")
+      {
+         std::vector<std::byte> buffer;
+         encode(buffer, full);
+
+         const auto view = maybe_view<point>::from(buffer);
+         REQUIRE(view.is_ok());
+         CHECK(view.borrow().is_some());
+         CHECK(view.borrow().value() == point{.x = 1, .y = -2});
+         CHECK(view.borrow().encoded_size() == std::size(buffer));
+         CHECK(view.borrow().to_maybe() == full);
+      }
+   }
+   GIVEN("Results & eithers with string payloads")
+   {
+      const result<std::string, failure> ok_value = ok(std::string("hello"));
+      const either<std::uint8_t, std::string> right_value = right(std::string("world"));
+
+      THEN("They round trip through the pluggable serializers")
+      {
+         std::vector<std::byte> buffer;
+         encode(buffer, ok_value);
+
+         const auto decoded_result = decode<result<std::string, failure>>(buffer);
+         REQUIRE(decoded_result.is_ok());
+         REQUIRE(decoded_result.borrow().is_ok());
+         CHECK(decoded_result.borrow().borrow() == "hello");
+
+         buffer.clear();
+         encode(buffer, right_value);
+
+         const auto decoded_either = decode<either<std::uint8_t, std::string>>(buffer);
+         REQUIRE(decoded_either.is_ok());
+         REQUIRE(decoded_either.borrow().is_right());
+         CHECK(decoded_either.borrow().borrow_right() == "world");
+      }
+      THEN("Nested monads round trip")
+      {
+         const maybe<result<int, failure>> nested =
+            some(result<int, failure>(err(failure::refused)));
+
+         std::vector<std::byte> buffer;
+         encode(buffer, nested);
+
+         const auto decoded = decode<maybe<result<int, failure>>>(buffer);
+         REQUIRE(decoded.is_ok());
+         REQUIRE(decoded.borrow().is_some());
+         CHECK(decoded.borrow().borrow().borrow_err() == failure::refused);
+      }
+   }
+   GIVEN("Malformed buffers")
+   {
+      std::vector<std::byte> buffer;
+      encode(buffer, result<std::string, failure>(ok(std::string("truncated"))));
+
+      THEN("Truncated buffers fail to decode")
+      {
+         const auto decoded =
+            decode<result<std::string, failure>>(std::span(buffer).first(std::size(buffer) - 1));
+
+         REQUIRE(decoded.is_err());
+         CHECK(decoded.borrow_err() == decode_error::truncated);
+         CHECK(maybe_view<point>::from({}).is_err());
+      }
+      THEN("Unknown tags fail to decode")
+      {
+         buffer[0] = std::byte{2};
+
+         const auto decoded = decode<result<std::string, failure>>(buffer);
+
+         REQUIRE(decoded.is_err());
+         CHECK(decoded.borrow_err() == decode_error::invalid_tag);
+         CHECK(result_view<int, failure>::from(buffer).borrow_err() == decode_error::invalid_tag);
+      }
+   }
+}
+
+SCENARIO("serialization - arrays", "[serialization]")
+{
+   GIVEN("An array of maybes")
+   {
+      std::vector<maybe<std::int64_t>> values;
+      for (std::int64_t i = 0; i < 20; ++i)
+      {
+         values.push_back(i % 3 == 0 ? maybe<std::int64_t>(none) : some(i * 10));
+      }
+
+      std::vector<std::byte> buffer;
+      encode_array(buffer, std::span<const maybe<std::int64_t>>(values));
+
+      THEN("The encoding holds a bitmap & a slot per element")
+      {
+         CHECK(std::size(buffer) == 8 + 8 + 20 * sizeof(std::int64_t));
+      }
+      THEN("A view gives random access to the elements")
+      {
+         const auto view = maybe_array_view<std::int64_t>::from(buffer);
+         REQUIRE(view.is_ok());
+         REQUIRE(view.borrow().size() == std::size(values));
+         CHECK(view.borrow().encoded_size() == std::size(buffer));
+
+         for (std::size_t i = 0; i < std::size(values); ++i)
+         {
+            CHECK(view.borrow()[i] == values[i]);
+         }
+      }
+      THEN("A truncated encoding is rejected")
+      {
+         const auto view =
+            maybe_array_view<std::int64_t>::from(std::span(buffer).first(std::size(buffer) - 1));
+
+         REQUIRE(view.is_err());
+         CHECK(view.borrow_err() == decode_error::truncated);
+      }
+      THEN("An encoding with bits set past the end of its bitmap is rejected")
+      {
+         buffer[8 + 2] |= std::byte{0x80};
+
+         const auto view = maybe_array_view<std::int64_t>::from(buffer);
+
+         REQUIRE(view.is_err());
+         CHECK(view.borrow_err() == decode_error::corrupted);
+      }
+   }
+   GIVEN("An array of results with a few errors")
+   {
+      std::vector<result<point, failure>> values;
+      for (std::int32_t i = 0; i < 30; ++i)
+      {
+         if (i % 7 == 3)
+         {
+            values.emplace_back(err(i % 2 == 0 ? failure::timeout : failure::refused));
+         }
+         else
+         {
+            values.emplace_back(ok(point{.x = i, .y = -i}));
+         }
+      }
+
+      std::vector<std::byte> buffer;
+      encode_array(buffer, std::span<const result<point, failure>>(values));
+
+      THEN("A view gives random access to values & errors")
+      {
+         const auto view = result_array_view<point, failure>::from(buffer);
+         REQUIRE(view.is_ok());
+         REQUIRE(view.borrow().size() == std::size(values));
+         CHECK(view.borrow().error_count() == 4);
+         CHECK(view.borrow().encoded_size() == std::size(buffer));
+
+         for (std::size_t i = 0; i < std::size(values); ++i)
+         {
+            CHECK(view.borrow()[i] == values[i]);
+         }
+      }
+      THEN("An encoding whose error count disagrees with its bitmap is rejected")
+      {
+         const std::size_t error_count_offset = 8 + 8 + std::size(values) * sizeof(point);
+         const std::uint64_t error_count = 0;
+         std::memcpy(buffer.data() + error_count_offset, &error_count, sizeof(error_count));
+
+         const auto view = result_array_view<point, failure>::from(buffer);
+
+         REQUIRE(view.is_err());
+         CHECK(view.borrow_err() == decode_error::corrupted);
+      }
+      THEN("An encoding with bits set past the end of its bitmap is rejected")
+      {
+         buffer[8 + 3] |= std::byte{0x80};
+
+         const auto view = result_array_view<point, failure>::from(buffer);
+
+         REQUIRE(view.is_err());
+         CHECK(view.borrow_err() == decode_error::corrupted);
+      }
+   }
+   GIVEN("An array of results spanning several rank blocks")
+   {
+      std::vector<result<point, failure>> values;
+      for (std::int32_t i = 0; i < 1200; ++i)
+      {
+         if (i % 5 == 0)
+         {
+            values.emplace_back(err(failure::timeout));
+         }
+         else
+         {
+            values.emplace_back(ok(point{.x = i, .y = i}));
+         }
+      }
+
+      std::vector<std::byte> buffer;
+      std::vector<std::byte> rank_index;
+      encode_array(buffer, std::span<const result<point, failure>>(values));
+      encode_rank_index(rank_index, std::span<const result<point, failure>>(values));
+
+      const auto set_entry = [&](std::size_t block, std::uint64_t ok_count) {
+         std::memcpy(rank_index.data() + block * sizeof(ok_count), &ok_count, sizeof(ok_count));
+      };
+
+      THEN("A view checks its rank index against the bitmap")
+      {
+         const auto view = result_array_view<point, failure>::from(buffer, rank_index);
+         REQUIRE(view.is_ok());
+
+         for (std::size_t i = 0; i < std::size(values); ++i)
+         {
+            CHECK(view.borrow()[i] == values[i]);
+         }
+      }
+      THEN("A rank index with a wrong count is rejected")
+      {
+         set_entry(1, 0);
+
+         const auto view = result_array_view<point, failure>::from(buffer, rank_index);
+
+         REQUIRE(view.is_err());
+         CHECK(view.borrow_err() == decode_error::corrupted);
+      }
+      THEN("A rank index counting more values than its block holds is rejected")
+      {
+         set_entry(2, 5000);
+
+         const auto view = result_array_view<point, failure>::from(buffer, rank_index);
+
+         REQUIRE(view.is_err());
+         CHECK(view.borrow_err() == decode_error::corrupted);
+      }
+   }
+}
@@ -0,0 +1,289 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/sum.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   template <std::size_t... Indices>
+   auto make_wide_sum(std::size_t index, std::index_sequence<Indices...> /* indices */)
+   {
+      using sum_t = sum<std::integral_constant<std::size_t, Indices>...>;
+
+      sum_t res(std::in_place_index<0>);
+      ((Indices == index ? void(res = sum_t(std::in_place_index<Indices>)) : void()), ...);
+
+      return res;
+   }
+
+   /**
+    * @brief Counts the instances alive, to catch alternatives destroyed twice.
+    */
+   struct alive
+   {
+      static inline int count = 0;
+
+      alive() noexcept { ++count; }
+      alive(const alive&) noexcept { ++count; }
+      alive(alive&&) noexcept { ++count; }
+      ~alive() { --count; }
+
+      auto operator=(const alive&) -> alive& = default;
+      auto operator=(alive&&) noexcept -> alive& = default;
+   };
+
+   /**
+    * @brief Throws when copied once 'fail' is set, and when moved too unless 'NothrowMove'.
+    */
+   template <bool NothrowMove>
+   struct fragile
+   {
+      static inline bool fail = false;
+
+      fragile() = default;
+      fragile(const fragile&) { throw_if_failing(); }
+      fragile(fragile&&) noexcept(NothrowMove) // NOLINT
+      {
+         if constexpr (not NothrowMove)
+         {
+            throw_if_failing();
+         }
+      }
+      ~fragile() = default;
+
+      auto operator=(const fragile&) -> fragile& = default;
+      auto operator=(fragile&&) noexcept(NothrowMove) -> fragile& = default; // NOLINT
+
+      static void throw_if_failing()
+      {
+         if (fail)
+         {
+            throw std::runtime_error("fragile");
+         }
+      }
+   };
+} // namespace
+
+SCENARIO("sum - layout", "[sum]")
+{
+   GIVEN("Sums with few & many alternatives")
+   {
+      using small_t = sum<int, float, char>;
+      using wide_t = decltype(make_wide_sum(0, std::make_index_sequence<40>()));
+
+      THEN("The discriminant uses the smallest type that fits")
+      {
+         CHECK(std::is_same_v<small_t::index_type, std::uint8_t>);
+         CHECK(std::is_same_v<wide_t::index_type, std::uint8_t>);
+         CHECK(std::is_same_v<detail::sum_index_t<300>, std::uint16_t>);
+      }
+      THEN("The alternatives share a flat storage")
+      {
+         CHECK(sizeof(sum<std::uint32_t, std::uint16_t, std::uint8_t>) == 8);
+         CHECK(sizeof(sum<char, char, char>) == 2);
+      }
+      THEN("Trivial alternatives make a trivial sum")
+      {
+         CHECK(std::is_trivially_copyable_v<small_t>);
+         CHECK(std::is_trivially_destructible_v<small_t>);
+         CHECK_FALSE(std::is_trivially_copyable_v<sum<int, std::string>>);
+         CHECK(is_trivially_relocatable_v<small_t>);
+         CHECK_FALSE(is_trivially_relocatable_v<sum<int, std::vector<int>>>);
+      }
+   }
+}
+
+SCENARIO("sum - constructor", "[sum]")
+{
+   GIVEN("A sum constructed using at<I>")
+   {
+      const sum<int, std::string, int> s = at<2>(3);
+
+      THEN("The sum holds the requested alternative")
+      {
+         REQUIRE(s.is<2>());
+         CHECK(s.index() == 2);
+         CHECK(s.borrow<2>() == 3);
+         CHECK_FALSE(s.is<0>());
+      }
+   }
+   GIVEN("A sum constructed from a value of a unique alternative")
+   {
+      const sum<int, std::string, double> s = std::string("hello");
+
+      THEN("The matching alternative is selected")
+      {
+         REQUIRE(s.is<1>());
+         CHECK(s.borrow<1>() == "hello");
+      }
+   }
+   GIVEN("A sum constructed from a string literal")
+   {
+      const sum<int, std::string> s = at<1>("hello");
+
+      THEN("The literal is stored as a string")
+      {
+         REQUIRE(s.is<1>());
+         CHECK(s == at<1>("hello"));
+      }
+   }
+   GIVEN("A sum with non-trivial alternatives")
+   {
+      sum<int, std::vector<int>, std::string> original = at<1>(std::vector({1, 2, 3}));
+
+      THEN("It may be copied & moved")
+      {
+         const auto copy = original; // NOLINT
+         const auto moved = std::move(original);
+
+         CHECK(copy == moved);
+         CHECK(copy.borrow<1>() == std::vector({1, 2, 3}));
+      }
+   }
+}
+
+SCENARIO("sum - assignment", "[sum]")
+{
+   GIVEN("Sums of non-trivial alternatives")
+   {
+      sum<std::string, std::vector<int>> s = at<0>("hello");
+      const sum<std::string, std::vector<int>> other = at<1>(std::vector({1}));
+
+      THEN("Assigning a different alternative switches the held one")
+      {
+         s = other;
+
+         REQUIRE(s.is<1>());
+         CHECK(s.borrow<1>() == std::vector({1}));
+
+         s = sum<std::string, std::vector<int>>(at<0>("world"));
+
+         REQUIRE(s.is<0>());
+         CHECK(s.borrow<0>() == "world");
+      }
+      THEN("Assigning the same alternative reuses the storage")
+      {
+         s = sum<std::string, std::vector<int>>(at<0>("world"));
+
+         REQUIRE(s.is<0>());
+         CHECK(s.borrow<0>() == "world");
+      }
+   }
+   GIVEN("Alternatives that may throw when moved")
+   {
+      THEN("The move operations are only noexcept when every alternative's are")
+      {
+         STATIC_REQUIRE(std::is_nothrow_move_assignable_v<sum<alive, fragile<true>>>);
+         STATIC_REQUIRE_FALSE(std::is_nothrow_move_assignable_v<sum<alive, fragile<false>>>);
+         STATIC_REQUIRE_FALSE(std::is_nothrow_move_constructible_v<sum<alive, fragile<false>>>);
+      }
+   }
+   GIVEN("A sum holding an alternative, assigned another one that throws when built")
+   {
+      THEN("A throwing copy leaves the held alternative untouched")
+      {
+         {
+            sum<alive, fragile<true>> s = at<0>(alive());
+            const sum<alive, fragile<true>> other = at<1>(fragile<true>());
+
+            fragile<true>::fail = true;
+            CHECK_THROWS_AS(s = other, std::runtime_error);
+            fragile<true>::fail = false;
+
+            CHECK(s.is<0>());
+            CHECK(alive::count == 1);
+         }
+
+         CHECK(alive::count == 0);
+      }
+      THEN("A throwing move puts the held alternative back")
+      {
+         {
+            sum<alive, fragile<false>> s = at<0>(alive());
+            sum<alive, fragile<false>> other = at<1>(fragile<false>());
+
+            fragile<false>::fail = true;
+            CHECK_THROWS_AS(s = std::move(other), std::runtime_error);
+            fragile<false>::fail = false;
+
+            CHECK(s.is<0>());
+            CHECK(alive::count == 1);
+         }
+
+         CHECK(alive::count == 0);
+      }
+   }
+}
+
+SCENARIO("sum - visitation", "[sum]")
+{
+   GIVEN("A sum of three alternatives")
+   {
+      sum<int, std::string, std::unique_ptr<int>> s = at<1>("hello");
+
+      THEN("match calls the overload of the held alternative")
+      {
+         const auto size = s.match([](int i) { return static_cast<std::size_t>(i); },
+                                   [](const std::string& str) { return str.size(); },
+                                   [](const std::unique_ptr<int>&) { return std::size_t{0}; });
+
+         CHECK(size == 5);
+      }
+      THEN("visit passes the alternative by reference")
+      {
+         s.visit([]<typename T>(T& value) {
+            if constexpr (std::is_same_v<T, std::string>)
+            {
+               value += ", world";
+            }
+         });
+
+         CHECK(s.borrow<1>() == "hello, world");
+      }
+      THEN("visit on an rvalue moves the alternative out")
+      {
+         sum<int, std::string, std::unique_ptr<int>> ptr = at<2>(std::make_unique<int>(4));
+
+         const auto value = std::move(ptr).match([](int) { return 0; },
+                                                 [](std::string&&) { return 0; },
+                                                 [](std::unique_ptr<int>&& p) {
+                                                    const auto owned = std::move(p);
+                                                    return *owned;
+                                                 });
+
+         CHECK(value == 4);
+      }
+   }
+   GIVEN("Sums with more alternatives than the switch handles")
+   {
+      THEN("Visitation goes through the table of function pointers")
+      {
+         for (std::size_t i : {0U, 1U, 17U, 33U, 39U})
+         {
+            const auto s = make_wide_sum(i, std::make_index_sequence<40>());
+
+            REQUIRE(s.index() == i);
+            CHECK(s.visit([](auto value) { return decltype(value)::value; }) == i);
+         }
+      }
+   }
+   GIVEN("A constant expression")
+   {
+      THEN("Visitation may be evaluated at compile time")
+      {
+         constexpr sum<int, char, long> s = at<2>(5L);
+
+         STATIC_REQUIRE(s.match([](int) { return 0L; }, [](char) { return 1L; },
+                                [](long l) { return l; }) == 5L);
+      }
+   }
+}
@@ -0,0 +1,134 @@
+/**
+ * @file support/counted.hpp
+ * @author wmbat wmbat@protonmail.com
+ * @date Monday, 19th of October 2026
+ * @brief Payload types counting their special member calls, used to bound the copies & moves
+ * done by the library
+ * @copyright Copyright (C) 2026 wmbat.
+ */
+
+#ifndef LIBREGLISSE_TESTS_SUPPORT_COUNTED_HPP
+#define LIBREGLISSE_TESTS_SUPPORT_COUNTED_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace reglisse::test
+{
+   /**
+    * @brief The number of special member calls made on counted payloads, and of global
+    * allocations, by the current thread.
+    */
+   struct operation_counts
+   {
+      std::size_t constructions = 0;
+      std::size_t copies = 0;
+      std::size_t moves = 0;
+      std::size_t copy_assignments = 0;
+      std::size_t move_assignments = 0;
+      std::size_t destructions = 0;
+      std::size_t allocations = 0;
+
+      std::size_t function_copies = 0;
+      std::size_t function_moves = 0;
+
+      constexpr auto operator==(const operation_counts&) const -> bool = default;
+   };
+
+   inline thread_local operation_counts counts; // NOLINT
+
+   /**
+    * @brief Set when the global operator new replaced by the test driver should count
+    * allocations.
+    */
+   inline thread_local bool count_allocations = false; // NOLINT
+
+   /**
+    * @brief A payload counting every construction, copy, move, assignment & destruction.
+    */
+   class counted
+   {
+   public:
+      counted() noexcept { ++counts.constructions; }
+      explicit counted(int value) noexcept : m_value(value) { ++counts.constructions; }
+      counted(const counted& other) noexcept : m_value(other.m_value) { ++counts.copies; }
+      counted(counted&& other) noexcept : m_value(other.m_value) { ++counts.moves; }
+      ~counted() { ++counts.destructions; }
+
+      auto operator=(const counted& rhs) noexcept -> counted&
+      {
+         m_value = rhs.m_value;
+         ++counts.copy_assignments;
+
+         return *this;
+      }
+      auto operator=(counted&& rhs) noexcept -> counted&
+      {
+         m_value = rhs.m_value;
+         ++counts.move_assignments;
+
+         return *this;
+      }
+
+      [[nodiscard]] constexpr auto value() const noexcept -> int { return m_value; }
+
+      constexpr auto operator==(const counted& rhs) const noexcept -> bool = default;
+
+   private:
+      int m_value = 0;
+   };
+
+   /**
+    * @brief A callable counting its copies & moves, forwarding its calls to 'Func'.
+    */
+   template <typename Func>
+   class counted_function
+   {
+   public:
+      explicit counted_function(Func func) : m_func(std::move(func)) {}
+      counted_function(const counted_function& other) : m_func(other.m_func)
+      {
+         ++counts.function_copies;
+      }
+      counted_function(counted_function&& other) noexcept :
+         m_func(std::move(other.m_func))
+      {
+         ++counts.function_moves;
+      }
+      ~counted_function() = default;
+
+      auto operator=(const counted_function&) -> counted_function& = delete;
+      auto operator=(counted_function&&) -> counted_function& = delete;
+
+      template <typename... Args>
+         requires std::invocable<const Func&, Args...>
+      constexpr auto operator()(Args&&... args) const -> std::invoke_result_t<const Func&, Args...>
+      {
+         return std::invoke(m_func, std::forward<Args>(args)...);
+      }
+
+   private:
+      Func m_func;
+   };
+
+   /**
+    * @brief Reset the counts, call 'func' & return the counts it produced, allocations included.
+    */
+   template <typename Func>
+   auto measure(Func&& func) -> operation_counts
+   {
+      counts = {};
+      count_allocations = true;
+
+      std::forward<Func>(func)();
+
+      count_allocations = false;
+
+      return std::exchange(counts, {});
+   }
+} // namespace reglisse::test
+
+#endif // LIBREGLISSE_TESTS_SUPPORT_COUNTED_HPP
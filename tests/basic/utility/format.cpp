@@ -0,0 +1,85 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/format.hpp>
+
+#if defined(__cpp_lib_format)
+
+#   include <catch2/catch.hpp>
+
+#   include <array>
+#   include <format>
+#   include <string>
+
+using namespace reglisse;
+
+SCENARIO("format - monads", "[format]")
+{
+   GIVEN("Maybes")
+   {
+      const maybe<double> full = some(3.14159);
+      const maybe<double> empty = none;
+
+      THEN("They are formatted as their alternative")
+      {
+         CHECK(std::format("{}", maybe<int>(some(1))) == "some(1)");
+         CHECK(std::format("{}", empty) == "none");
+      }
+      THEN("The format spec is forwarded to the value")
+      {
+         CHECK(std::format("{:>10.3f}", full) == "some(     3.142)");
+         CHECK(std::format("{:>10.3f}", empty) == "none");
+      }
+   }
+   GIVEN("Results & eithers")
+   {
+      const result<int, std::string> good = ok(42);
+      const result<int, std::string> bad = err(std::string("refused"));
+      const either<std::string, int> side = right(7);
+
+      THEN("They are formatted as their alternative")
+      {
+         CHECK(std::format("{}", good) == "ok(42)");
+         CHECK(std::format("{}", bad) == "err(refused)");
+         CHECK(std::format("{}", side) == "right(7)");
+         CHECK(std::format("{}", either<std::string, int>(left(std::string("l")))) == "left(l)");
+      }
+      THEN("The format spec is forwarded to every alternative")
+      {
+         CHECK(std::format("{:<4}", good) == "ok(42  )");
+         CHECK(std::format("{:<4}", bad) == "err(refused)");
+         CHECK(std::format("{:*^3}", side) == "right(*7*)");
+      }
+      THEN("Specs are parsed up to their closing brace only")
+      {
+         CHECK(std::format("{:<4}|{:>3}|{}", good, bad, side) == "ok(42  )|err(refused)|right(7)");
+         CHECK(std::format("[{:<3}]", result<int, int>(err(5))) == "[err(5  )]");
+      }
+   }
+   GIVEN("The helpers")
+   {
+      THEN("They are formatted like the monads they build")
+      {
+         CHECK(std::format("{} {}", some(1), none) == "some(1) none");
+         CHECK(std::format("{} {}", ok(1), err(2)) == "ok(1) err(2)");
+         CHECK(std::format("{:02} {:02}", left(1), right(2)) == "left(01) right(02)");
+      }
+   }
+   GIVEN("A fixed output buffer")
+   {
+      std::array<char, 16> buffer = {};
+
+      THEN("Monads are written straight to it")
+      {
+         const auto res = std::format_to_n(buffer.data(), std::size(buffer), "{}",
+                                           result<int, int>(err(404)));
+
+         CHECK(std::string_view(buffer.data(), res.out) == "err(404)");
+      }
+      THEN("Wide characters are supported")
+      {
+         CHECK(std::format(L"{}", maybe<int>(some(5))) == L"some(5)");
+      }
+   }
+}
+
+#endif // defined(__cpp_lib_format)
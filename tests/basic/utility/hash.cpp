@@ -0,0 +1,98 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/hash.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace reglisse;
+
+namespace
+{
+   struct unhashable
+   {
+   };
+} // namespace
+
+static_assert(not std::is_default_constructible_v<std::hash<maybe<unhashable>>>);
+static_assert(not std::is_default_constructible_v<std::hash<result<int, unhashable>>>);
+
+SCENARIO("hash - std::hash specializations", "[hash]")
+{
+   GIVEN("Monads holding equal payloads in different alternatives")
+   {
+      const either<int, int> left_value = left(1);
+      const either<int, int> right_value = right(1);
+      const result<int, int> ok_value = ok(0);
+      const result<int, int> err_value = err(0);
+
+      THEN("Their hashes differ")
+      {
+         CHECK(std::hash<either<int, int>>()(left_value) !=
+               std::hash<either<int, int>>()(right_value));
+         CHECK(std::hash<result<int, int>>()(ok_value) != std::hash<result<int, int>>()(err_value));
+         CHECK(std::hash<maybe<int>>()(maybe<int>(some(0))) != std::hash<maybe<int>>()(none));
+      }
+      THEN("Equal monads hash the same")
+      {
+         CHECK(std::hash<either<int, int>>()(left_value) ==
+               std::hash<either<int, int>>()(either<int, int>(left(1))));
+      }
+   }
+   GIVEN("An unordered set of results")
+   {
+      std::unordered_set<result<int, std::string>> set;
+      set.insert(ok(1));
+      set.insert(err(std::string("refused")));
+      set.insert(ok(1));
+
+      THEN("Monads are used as keys")
+      {
+         CHECK(std::size(set) == 2);
+         CHECK(set.contains(result<int, std::string>(err(std::string("refused")))));
+         CHECK(not set.contains(result<int, std::string>(ok(2))));
+      }
+   }
+}
+
+SCENARIO("hash - heterogeneous lookup", "[hash]")
+{
+   GIVEN("A map keyed on maybes of strings")
+   {
+      std::unordered_map<maybe<std::string>, int, monad_hash, monad_equal> map;
+      map.emplace(some(std::string("alpha")), 1);
+      map.emplace(some(std::string("beta")), 2);
+      map.emplace(none, 3);
+
+      THEN("Helpers holding string views hash like the keys")
+      {
+         CHECK(monad_hash()(maybe<std::string>(some(std::string("alpha")))) ==
+               monad_hash()(some(std::string_view("alpha"))));
+         CHECK(monad_hash()(maybe<std::string>(none)) == monad_hash()(none));
+      }
+      THEN("They find the keys without building strings")
+      {
+         CHECK(map.find(some(std::string_view("beta")))->second == 2);
+         CHECK(map.find(none)->second == 3);
+         CHECK(map.find(some(std::string_view("gamma"))) == std::end(map));
+      }
+   }
+   GIVEN("A map keyed on results")
+   {
+      std::unordered_map<result<std::string, int>, int, monad_hash, monad_equal> map;
+      map.emplace(ok(std::string("0")), 1);
+      map.emplace(err(0), 2);
+
+      THEN("Values & errors are told apart")
+      {
+         CHECK(map.find(ok(std::string_view("0")))->second == 1);
+         CHECK(map.find(err(0))->second == 2);
+         CHECK(not monad_equal()(ok(0), err(0)));
+         CHECK(not monad_equal()(maybe<int>(some(0)), ok(0)));
+      }
+   }
+}
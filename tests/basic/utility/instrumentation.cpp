@@ -0,0 +1,167 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+#define LIBREGLISSE_USE_INSTRUMENTATION
+
+#include <libreglisse/instrumentation.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/or_else.hpp>
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace reglisse;
+
+static_assert(sizeof(maybe<int>) == 2 * sizeof(int));
+static_assert(sizeof(result<int, int>) == 2 * sizeof(int));
+
+namespace
+{
+   auto local_sites(call_site_kind kind) -> std::vector<call_site_stats>
+   {
+      std::vector<call_site_stats> res;
+
+      std::ranges::copy_if(call_site_snapshot(), std::back_inserter(res), [&](const auto& stats) {
+         return stats.kind == kind and stats.calls > 0 and
+            stats.file_name == std::source_location::current().file_name();
+      });
+
+      return res;
+   }
+
+   auto parse(int i) -> result<int, std::string>
+   {
+      if (i < 0)
+      {
+         return err(std::string("negative"));
+      }
+
+      return ok(i * 2);
+   }
+
+   auto half(int i) -> maybe<int>
+   {
+      if (i % 2 != 0)
+      {
+         return none;
+      }
+
+      return some(i / 2);
+   }
+} // namespace
+
+SCENARIO("instrumentation - stages", "[instrumentation]")
+{
+   reset_call_sites();
+
+   GIVEN("A pipeline of and_then & or_else stages")
+   {
+      for (int i = -2; i < 8; ++i)
+      {
+         const result<int, std::string> input = ok(i);
+         const auto output = input | and_then(parse) |
+            or_else([](const std::string&) -> result<int, std::string> { return ok(0); });
+
+         REQUIRE(output.is_ok());
+      }
+
+      THEN("Each stage counts its calls & errors at its own location")
+      {
+         const auto and_then_sites = local_sites(call_site_kind::and_then);
+         const auto or_else_sites = local_sites(call_site_kind::or_else);
+
+         REQUIRE(and_then_sites.size() == 1);
+         CHECK(and_then_sites[0].calls == 10);
+         CHECK(and_then_sites[0].errors == 2);
+
+         REQUIRE(or_else_sites.size() == 1);
+         CHECK(or_else_sites[0].calls == 10);
+         CHECK(or_else_sites[0].errors == 0);
+         CHECK(or_else_sites[0].line == and_then_sites[0].line + 1);
+      }
+   }
+   GIVEN("A direct call of an operation")
+   {
+      const auto output = and_then(maybe<int>(some(3)), half);
+
+      CHECK(output.is_none());
+
+      THEN("The call is recorded as a failure")
+      {
+         const auto sites = local_sites(call_site_kind::and_then);
+
+         REQUIRE(sites.size() == 1);
+         CHECK(sites[0].calls == 1);
+         CHECK(sites[0].errors == 1);
+      }
+   }
+}
+
+SCENARIO("instrumentation - construction sites", "[instrumentation]")
+{
+   reset_call_sites();
+
+   GIVEN("Functions building errors & empty maybes")
+   {
+      for (int i = 0; i < 5; ++i)
+      {
+         static_cast<void>(parse(-i - 1));
+         static_cast<void>(half(2 * i + 1));
+      }
+
+      THEN("The err & none sites count their constructions")
+      {
+         const auto err_sites = local_sites(call_site_kind::err);
+         const auto none_sites = local_sites(call_site_kind::none);
+
+         REQUIRE(err_sites.size() == 1);
+         CHECK(err_sites[0].calls == 5);
+         CHECK(err_sites[0].function_name.find("parse") != std::string_view::npos);
+
+         REQUIRE(none_sites.size() == 1);
+         CHECK(none_sites[0].calls == 5);
+         CHECK(none_sites[0].function_name.find("half") != std::string_view::npos);
+      }
+   }
+   GIVEN("Records made by other threads")
+   {
+      std::vector<std::thread> threads;
+      for (int t = 0; t < 4; ++t)
+      {
+         threads.emplace_back([] {
+            for (int i = 0; i < 100; ++i)
+            {
+               static_cast<void>(parse(-1));
+            }
+         });
+      }
+
+      for (auto& thread : threads)
+      {
+         thread.join();
+      }
+
+      THEN("The snapshot merges the tables of every thread")
+      {
+         const auto err_sites = local_sites(call_site_kind::err);
+
+         REQUIRE(err_sites.size() == 1);
+         CHECK(err_sites[0].calls == 400);
+      }
+      THEN("The export writes a line per call site")
+      {
+         std::ostringstream os;
+         export_call_sites(os);
+
+         const std::string csv = os.str();
+
+         CHECK(csv.starts_with("kind,file,line,column,function,calls,errors,error_ns\n"));
+         CHECK(csv.find("err,\"") != std::string::npos);
+      }
+   }
+}
@@ -0,0 +1,114 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/relocate.hpp>
+#include <libreglisse/result.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace reglisse;
+
+namespace
+{
+   /**
+    * @brief A type holding an owning pointer, which is safe to relocate with memmove.
+    */
+   struct boxed
+   {
+      std::unique_ptr<int> value;
+   };
+} // namespace
+
+template <>
+struct reglisse::is_trivially_relocatable<boxed> : std::true_type
+{};
+
+static_assert(std::is_trivially_copyable_v<maybe<int>>);
+static_assert(std::is_trivially_copyable_v<result<int, float>>);
+static_assert(std::is_trivially_copyable_v<either<int, double>>);
+static_assert(not std::is_trivially_copyable_v<maybe<std::string>>);
+
+static_assert(is_trivially_relocatable_v<maybe<int>>);
+static_assert(is_trivially_relocatable_v<maybe<boxed>>);
+static_assert(is_trivially_relocatable_v<result<boxed, int>>);
+static_assert(is_trivially_relocatable_v<either<int, boxed>>);
+static_assert(not is_trivially_relocatable_v<result<boxed, std::string>>);
+
+SCENARIO("Relocating monads", "[relocate]")
+{
+   GIVEN("a buffer of trivially relocatable maybes")
+   {
+      alignas(maybe<boxed>) std::byte source_storage[sizeof(maybe<boxed>) * 3];
+      alignas(maybe<boxed>) std::byte dest_storage[sizeof(maybe<boxed>) * 3];
+
+      auto* source = reinterpret_cast<maybe<boxed>*>(source_storage); // NOLINT
+      auto* dest = reinterpret_cast<maybe<boxed>*>(dest_storage);     // NOLINT
+
+      std::construct_at(source, some(boxed{std::make_unique<int>(1)}));
+      std::construct_at(source + 1, none);                                // NOLINT
+      std::construct_at(source + 2, some(boxed{std::make_unique<int>(3)})); // NOLINT
+
+      WHEN("the buffer is relocated")
+      {
+         auto* last = uninitialized_relocate(source, source + 3, dest); // NOLINT
+
+         THEN("the content is found at the destination")
+         {
+            CHECK(last == dest + 3); // NOLINT
+            REQUIRE(dest[0].is_some());
+            CHECK(*dest[0].borrow().value == 1);
+            CHECK(dest[1].is_none());
+            REQUIRE(dest[2].is_some());
+            CHECK(*dest[2].borrow().value == 3);
+         }
+
+         std::destroy(dest, dest + 3); // NOLINT
+      }
+   }
+   GIVEN("a result holding a non trivially relocatable type")
+   {
+      using result_t = result<std::string, int>;
+
+      alignas(result_t) std::byte source_storage[sizeof(result_t)];
+      alignas(result_t) std::byte dest_storage[sizeof(result_t)];
+
+      auto* source = std::construct_at(reinterpret_cast<result_t*>(source_storage), // NOLINT
+                                       ok(std::string(32, 'a')));
+      auto* dest = reinterpret_cast<result_t*>(dest_storage); // NOLINT
+
+      WHEN("it is relocated")
+      {
+         relocate_at(source, dest);
+
+         THEN("the value is moved to the destination")
+         {
+            REQUIRE(dest->is_ok());
+            CHECK(dest->borrow() == std::string(32, 'a'));
+         }
+
+         std::destroy_at(dest);
+      }
+   }
+   GIVEN("an either in storage")
+   {
+      alignas(either<int, boxed>) std::byte storage[sizeof(either<int, boxed>)];
+
+      auto* source = std::construct_at(reinterpret_cast<either<int, boxed>*>(storage), // NOLINT
+                                       right(boxed{std::make_unique<int>(2)}));
+
+      WHEN("it is relocated into a value")
+      {
+         const either res = relocate(source);
+
+         THEN("the value is found in the result")
+         {
+            REQUIRE(res.is_right());
+            CHECK(*res.borrow_right().value == 2);
+         }
+      }
+   }
+}
@@ -0,0 +1,126 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include "../support/counted.hpp"
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/or_else.hpp>
+#include <libreglisse/operations/transform.hpp>
+#include <libreglisse/operations/transform_err.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <optional>
+#include <string>
+
+#if defined(__cpp_lib_expected)
+#   include <expected>
+#endif // defined(__cpp_lib_expected)
+
+using namespace reglisse;
+using namespace reglisse::test;
+
+static_assert(not std::is_convertible_v<std::optional<int>, maybe<int>>);
+static_assert(std::is_constructible_v<maybe<int>, std::optional<int>>);
+
+SCENARIO("std interop - std::optional", "[std_interop]")
+{
+   GIVEN("Optionals")
+   {
+      const std::optional<int> full = 3;
+      const std::optional<int> empty = std::nullopt;
+
+      THEN("Maybes are built from them")
+      {
+         CHECK(maybe<int>(full) == maybe<int>(some(3)));
+         CHECK(maybe<int>(empty).is_none());
+      }
+      THEN("Maybes are converted back to them")
+      {
+         CHECK(maybe<int>(some(3)).to_optional() == full);
+         CHECK(maybe<int>(none).to_optional() == empty);
+      }
+      THEN("Operations accept them directly")
+      {
+         const auto twice = [](int i) {
+            return i * 2;
+         };
+         const auto positive = [](int i) -> maybe<int> {
+            return i > 0 ? maybe<int>(some(i)) : none;
+         };
+
+         CHECK(transform(full, twice) == maybe<int>(some(6)));
+         CHECK((full | transform(twice)) == maybe<int>(some(6)));
+         CHECK((std::optional<int>(-1) | and_then(positive)).is_none());
+         CHECK((empty | or_else([] { return maybe<int>(some(0)); })) == maybe<int>(some(0)));
+      }
+   }
+   GIVEN("A maybe holding a counted payload")
+   {
+      maybe<counted> m = some(counted(1));
+
+      THEN("Conversions move the payload once")
+      {
+         CHECK(measure([&] { static_cast<void>(std::move(m).to_optional()); }).moves == 1);
+         CHECK(measure([] {
+                  static_cast<void>(maybe<counted>(std::optional<counted>(std::in_place, 1)));
+               }).moves == 1);
+      }
+      THEN("Borrowing it as an optional touches no payload")
+      {
+         const auto measured = measure([&] {
+            const auto borrowed = std::as_const(m).borrow_optional();
+            CHECK(&borrowed->get() == &m.borrow());
+         });
+
+         CHECK(measured.copies == 0);
+         CHECK(measured.moves == 0);
+         CHECK(not maybe<counted>(none).borrow_optional().has_value());
+      }
+   }
+}
+
+#if defined(__cpp_lib_expected)
+SCENARIO("std interop - std::expected", "[std_interop]")
+{
+   GIVEN("Expecteds")
+   {
+      const std::expected<int, std::string> value = 3;
+      const std::expected<int, std::string> error = std::unexpected(std::string("refused"));
+
+      THEN("Results are built from them & converted back")
+      {
+         CHECK(result<int, std::string>(value) == result<int, std::string>(ok(3)));
+         CHECK(result<int, std::string>(error).borrow_err() == "refused");
+         CHECK(result<int, std::string>(value).to_expected() == value);
+         CHECK(result<int, std::string>(error).to_expected() == error);
+      }
+      THEN("Operations accept them directly")
+      {
+         const auto twice = [](int i) {
+            return i * 2;
+         };
+
+         CHECK((value | transform(twice)) == result<int, std::string>(ok(6)));
+         CHECK((error | transform_err([](const std::string& s) { return s.size(); }))
+                  .borrow_err() == 7);
+      }
+      THEN("Results are borrowed as expecteds of references")
+      {
+         const result<int, std::string> r = err(std::string("refused"));
+
+         CHECK(&r.borrow_expected().error().get() == &r.borrow_err());
+      }
+      THEN("Mutable results are borrowed as expecteds of mutable references")
+      {
+         result<int, std::string> r = ok(1);
+
+         r.borrow_expected().value().get() = 5;
+
+         CHECK(r.borrow() == 5);
+      }
+   }
+}
+#endif // defined(__cpp_lib_expected)
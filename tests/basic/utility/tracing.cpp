@@ -0,0 +1,170 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+#define LIBREGLISSE_USE_INSTRUMENTATION
+#define LIBREGLISSE_USE_TRACING
+
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/operations/and_then.hpp>
+#include <libreglisse/operations/transform.hpp>
+#include <libreglisse/result.hpp>
+#include <libreglisse/tracing.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   struct parse_fn
+   {
+      auto operator()(int i) const -> result<int, std::string> { return ok(i * 2); }
+   };
+
+   auto count(const std::string& str, std::string_view pattern) -> std::size_t
+   {
+      std::size_t res = 0;
+      for (auto pos = str.find(pattern); pos != std::string::npos;
+           pos = str.find(pattern, pos + pattern.size()))
+      {
+         ++res;
+      }
+
+      return res;
+   }
+
+   auto timestamps(const std::string& json) -> std::vector<double>
+   {
+      const std::string_view key = "\"ts\":";
+
+      std::vector<double> res;
+      for (auto pos = json.find(key); pos != std::string::npos; pos = json.find(key, pos + 1))
+      {
+         res.push_back(std::stod(json.substr(pos + key.size())));
+      }
+
+      return res;
+   }
+} // namespace
+
+SCENARIO("tracing - stage names", "[tracing]")
+{
+   GIVEN("Operation functors & callables")
+   {
+      THEN("The operation name drops the namespaces & the '_fn' suffix")
+      {
+         STATIC_REQUIRE(detail::operation_name<and_then_fn>() == "and_then");
+         STATIC_REQUIRE(detail::operation_name<transform_fn>() == "transform");
+      }
+      THEN("The callable name is given by 'traced' or by its type")
+      {
+         const auto named = traced([](int i) { return i; }, "identity");
+
+         CHECK(std::string_view(detail::callable_name(named)) == "identity");
+         CHECK(std::string_view(detail::callable_name(parse_fn())).ends_with("parse_fn"));
+         CHECK(std::string_view(detail::callable_name()).empty());
+      }
+   }
+}
+
+SCENARIO("tracing - writing traces", "[tracing]")
+{
+   GIVEN("A traced pipeline")
+   {
+      std::ostringstream discard;
+      static_cast<void>(write_trace(discard));
+
+      for (int i = 0; i < 3; ++i)
+      {
+         const result<int, std::string> input = ok(i);
+         const auto output = input | and_then(parse_fn()) |
+            transform(traced([](int value) { return value + 1; }, "increment"));
+
+         REQUIRE(output.is_ok());
+      }
+
+      THEN("Every stage emits a single complete event, instrumented stages included")
+      {
+         std::ostringstream os;
+         const std::size_t written = write_trace(os);
+         const std::string json = os.str();
+
+         CHECK(written == 6);
+         CHECK(json.starts_with("{\"traceEvents\":["));
+         CHECK(count(json, "{\"name\":\"and_then\"") == 3);
+         CHECK(count(json, "{\"name\":\"transform\"") == 3);
+         CHECK(count(json, "\"callable\":\"increment\"") == 3);
+         CHECK(count(json, "\"ph\":\"X\"") == 6);
+         CHECK(count(json, "\"dur\":") == 6);
+      }
+      THEN("Written events are drained from the buffers")
+      {
+         std::ostringstream first;
+         std::ostringstream second;
+
+         CHECK(write_trace(first) == 6);
+         CHECK(write_trace(second) == 0);
+      }
+   }
+   GIVEN("Stages run by another thread")
+   {
+      std::ostringstream discard;
+      static_cast<void>(write_trace(discard));
+
+      std::thread([] {
+         static_cast<void>(and_then(maybe<int>(some(1)), [](int i) {
+            return maybe<int>(some(i));
+         }));
+      }).join();
+
+      THEN("Its events are written after it exits")
+      {
+         std::ostringstream os;
+
+         CHECK(write_trace(os) == 1);
+      }
+   }
+}
+
+SCENARIO("tracing - timestamps", "[tracing]")
+{
+   GIVEN("Stages traced long after the trace epoch, a few ticks apart")
+   {
+      std::ostringstream discard;
+      static_cast<void>(write_trace(discard));
+
+      // Every counter used for ticks runs at 1 GHz or more, so this is past the first second
+      const std::uint64_t later = detail::first_trace_epoch().ticks + 10'000'000'000; // NOLINT
+
+      detail::trace_buffer* buffer = detail::local_trace_buffer();
+      REQUIRE(buffer != nullptr);
+
+      for (std::uint64_t i = 0; i < 3; ++i)
+      {
+         buffer->push("stage", "", later + i * 10'000, later + i * 10'000 + 100); // NOLINT
+      }
+
+      THEN("Their timestamps stay distinct & ordered, whatever the format of the stream")
+      {
+         std::ostringstream os;
+         os << std::scientific << std::setprecision(2);
+
+         REQUIRE(write_trace(os) == 3);
+
+         const std::vector<double> ts = timestamps(os.str());
+
+         REQUIRE(ts.size() == 3);
+         CHECK(ts[0] > 1'000'000.0);
+         CHECK(ts[0] < ts[1]);
+         CHECK(ts[1] < ts[2]);
+         CHECK((os.flags() & std::ios_base::floatfield) == std::ios_base::scientific);
+         CHECK(os.precision() == 2);
+      }
+   }
+}
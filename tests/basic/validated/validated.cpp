@@ -0,0 +1,332 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/validated.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+
+using namespace reglisse;
+
+namespace
+{
+   /**
+    * @brief A memory resource counting the allocations made through it.
+    */
+   class counting_resource : public std::pmr::memory_resource
+   {
+   public:
+      [[nodiscard]] auto allocations() const noexcept -> int { return m_allocations; }
+
+   private:
+      auto do_allocate(std::size_t bytes, std::size_t alignment) -> void* override
+      {
+         ++m_allocations;
+
+         return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+      }
+      void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+      {
+         std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+      }
+      [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+         -> bool override
+      {
+         return this == &other;
+      }
+
+      int m_allocations = 0;
+   };
+
+   auto check_name(const std::string& name) -> validated<std::string, std::string>
+   {
+      if (name.empty())
+      {
+         return err(std::string("empty name"));
+      }
+
+      return ok(name);
+   }
+
+   /**
+    * @brief A value whose copies & moves throw once 'fail' is set.
+    */
+   struct fragile
+   {
+      static inline bool fail = false;
+
+      explicit fragile(int i) : value(i) {}
+      fragile(const fragile& other) : value(other.value) { throw_if_failing(); }
+      fragile(fragile&& other) : value(other.value) { throw_if_failing(); } // NOLINT
+      ~fragile() = default;
+
+      auto operator=(const fragile&) -> fragile& = default;
+      auto operator=(fragile&&) -> fragile& = default; // NOLINT
+
+      static void throw_if_failing()
+      {
+         if (fail)
+         {
+            throw std::runtime_error("fragile");
+         }
+      }
+
+      int value;
+   };
+
+   auto check_age(int age) -> validated<int, std::string>
+   {
+      if (age < 0)
+      {
+         return err(std::string("negative age"));
+      }
+
+      return ok(age);
+   }
+} // namespace
+
+TEST_CASE("error_list - inline storage", "[validated][error_list]")
+{
+   error_list<int, 2> errors(std::pmr::null_memory_resource());
+
+   errors.push_back(1);
+   errors.push_back(2);
+
+   CHECK(errors.is_inline());
+   CHECK(errors.size() == 2);
+   CHECK_THROWS_AS(errors.push_back(3), std::bad_alloc);
+
+   counting_resource resource;
+   error_list<std::string, 2> spilled(&resource);
+
+   spilled.push_back("a");
+   spilled.push_back("b");
+   spilled.push_back("c");
+
+   CHECK_FALSE(spilled.is_inline());
+   CHECK(resource.allocations() == 1);
+   CHECK(spilled == error_list<std::string, 2>{"a", "b", "c"});
+
+   const error_list<std::string, 2> moved = std::move(spilled);
+
+   CHECK(moved.size() == 3);
+   CHECK(spilled.empty()); // NOLINT
+   CHECK(resource.allocations() == 1);
+}
+
+SCENARIO("validated - accumulation of errors", "[validated]")
+{
+   GIVEN("valid fields")
+   {
+      std::pmr::memory_resource* previous =
+         std::pmr::set_default_resource(std::pmr::null_memory_resource());
+
+      const auto res = apply(
+         [](const std::string& name, int age) {
+            return name + ":" + std::to_string(age);
+         },
+         check_name("bob"), check_age(42));
+
+      std::pmr::set_default_resource(previous);
+
+      THEN("the function is called without allocating any error storage")
+      {
+         REQUIRE(res.is_ok());
+         CHECK(res.borrow() == "bob:42");
+         CHECK(res.errors().empty());
+      }
+   }
+   GIVEN("invalid fields")
+   {
+      const auto res = zip(check_name(""), check_age(1), check_age(-1));
+
+      THEN("every error is kept, in order")
+      {
+         REQUIRE(res.is_err());
+         REQUIRE(res.errors().size() == 2);
+         CHECK(res.errors()[0] == "empty name");
+         CHECK(res.errors()[1] == "negative age");
+      }
+   }
+   GIVEN("more errors than the inline capacity")
+   {
+      counting_resource resource;
+
+      const validated<int, int, 2> first = err(error_list<int, 2>({1, 2}, &resource));
+      const validated<int, int, 2> second = err(3);
+
+      const auto res = zip(first, second, second);
+
+      THEN("the errors spill to the resource of the first invalid monad")
+      {
+         REQUIRE(res.is_err());
+         CHECK(res.borrow_err() == error_list<int, 2>{1, 2, 3, 3});
+         CHECK(res.borrow_err().resource() == &resource);
+         CHECK(resource.allocations() == 1);
+      }
+   }
+}
+
+SCENARIO("validated - operations", "[validated]")
+{
+   GIVEN("a valid monad")
+   {
+      const validated<int, std::string> v = ok(2);
+
+      THEN("'transform' keeps the validated type")
+      {
+         const auto res = v | transform([](int i) {
+                             return i * 3;
+                          });
+
+         STATIC_REQUIRE(std::same_as<decltype(res), const validated<int, std::string>>);
+         CHECK(res.borrow() == 6);
+      }
+   }
+   GIVEN("an invalid monad")
+   {
+      const validated<int, int> v = err(error_list<int, 4>{1, 2});
+
+      THEN("'transform_err' maps every error")
+      {
+         const auto res = v | transform_err([](int e) {
+                             return std::to_string(e);
+                          });
+
+         REQUIRE(res.is_err());
+         CHECK(res.errors()[0] == "1");
+         CHECK(res.errors()[1] == "2");
+      }
+   }
+   GIVEN("zipped monads")
+   {
+      THEN("'apply' may be piped onto them")
+      {
+         const auto res = check_name("alice") | zip(check_age(30)) |
+            apply([](const std::string& name, int age) {
+                            return name.size() + static_cast<std::size_t>(age);
+                         });
+
+         REQUIRE(res.is_ok());
+         CHECK(res.borrow() == 35);
+      }
+   }
+}
+
+SCENARIO("validated - conversions from and to result", "[validated]")
+{
+   GIVEN("a result holding an error")
+   {
+      const result<int, std::string> r = err(std::string("failure"));
+      const validated<int, std::string> v = r;
+
+      THEN("the validated monad holds a single error")
+      {
+         REQUIRE(v.is_err());
+         CHECK(v.errors().size() == 1);
+      }
+      THEN("it converts back to a result of the error list")
+      {
+         const result back = v.to_result();
+
+         REQUIRE(back.is_err());
+         CHECK(back.borrow_err()[0] == "failure");
+      }
+   }
+   GIVEN("a result holding a value")
+   {
+      const validated<int, std::string> v = result<int, std::string>(ok(4));
+
+      THEN("the value is kept") { CHECK(v.to_result().borrow() == 4); }
+   }
+}
+
+SCENARIO("validated - assignment", "[validated]")
+{
+   GIVEN("an invalid monad & a valid one whose value throws when copied or moved")
+   {
+      validated<fragile, std::string> invalid = err(std::string("failure"));
+      const validated<fragile, std::string> valid = ok(fragile(3));
+
+      fragile::fail = true;
+
+      THEN("a failed copy assignment keeps the errors")
+      {
+         CHECK_THROWS_AS(invalid = valid, std::runtime_error);
+         REQUIRE(invalid.is_err());
+         CHECK(invalid.borrow_err()[0] == "failure");
+      }
+      THEN("a failed move assignment keeps the errors")
+      {
+         fragile::fail = false;
+         validated<fragile, std::string> moved = valid;
+         fragile::fail = true;
+
+         CHECK_THROWS_AS(invalid = std::move(moved), std::runtime_error);
+         REQUIRE(invalid.is_err());
+         CHECK(invalid.borrow_err()[0] == "failure");
+      }
+
+      fragile::fail = false;
+   }
+   GIVEN("two valid monads")
+   {
+      validated<std::string, std::string> lhs = ok(std::string("a"));
+      const validated<std::string, std::string> rhs = ok(std::string("b"));
+
+      THEN("the value is assigned in place")
+      {
+         lhs = rhs;
+
+         CHECK(lhs.borrow() == "b");
+      }
+   }
+   GIVEN("two invalid monads")
+   {
+      validated<int, std::string> lhs = err(std::string("a"));
+      validated<int, std::string> rhs = err(std::string("b"));
+
+      THEN("the errors are replaced")
+      {
+         lhs = std::move(rhs);
+
+         REQUIRE(lhs.is_err());
+         CHECK(lhs.borrow_err() == error_list<std::string, 4>{"b"});
+      }
+   }
+}
+
+SCENARIO("error_list - growth", "[validated][error_list]")
+{
+   GIVEN("a full list")
+   {
+      const std::string first = "an error too long to fit in the small string buffer";
+
+      error_list<std::string, 2> list{first, "b"};
+
+      WHEN("one of its own errors is pushed into it")
+      {
+         list.push_back(list[0]);
+
+         THEN("the error is copied before the list is relocated")
+         {
+            REQUIRE(list.size() == 3);
+            CHECK(list[0] == first);
+            CHECK(list[2] == first);
+         }
+      }
+      WHEN("its own errors are pushed into it past the first growth")
+      {
+         list.push_back(list[0]);
+         list.push_back(list[1]);
+         list.push_back(list[2]);
+
+         THEN("every copy is kept")
+         {
+            CHECK(list == error_list<std::string, 2>{first, "b", first, "b", first});
+         }
+      }
+   }
+}
@@ -0,0 +1,150 @@
+#define LIBREGLISSE_USE_EXCEPTIONS
+
+#include <libreglisse/either.hpp>
+#include <libreglisse/maybe.hpp>
+#include <libreglisse/result.hpp>
+#include <libreglisse/views.hpp>
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace reglisse;
+
+namespace
+{
+   template <std::ranges::range Range>
+   auto to_vector(Range&& range)
+   {
+      std::vector<std::remove_cvref_t<std::ranges::range_reference_t<Range>>> res;
+      for (auto&& value : range)
+      {
+         res.push_back(value);
+      }
+
+      return res;
+   }
+} // namespace
+
+SCENARIO("views - values & errors", "[views]")
+{
+   GIVEN("A vector of maybes")
+   {
+      std::vector<maybe<int>> maybes = {some(1), none, some(3), none, some(5)};
+
+      THEN("'values' yields references to the values stored")
+      {
+         auto view = maybes | views::values;
+
+         STATIC_REQUIRE(std::is_same_v<std::ranges::range_reference_t<decltype(view)>, int&>);
+         CHECK(to_vector(view) == std::vector({1, 3, 5}));
+
+         for (int& value : view)
+         {
+            value *= 2;
+         }
+
+         CHECK(maybes[2].borrow() == 6);
+      }
+   }
+   GIVEN("A vector of results")
+   {
+      const std::vector<result<int, std::string>> results = {
+         ok(1), err(std::string("first")), ok(2), err(std::string("second"))};
+
+      THEN("'values' yields the values & 'errors' the errors")
+      {
+         CHECK(to_vector(results | views::values) == std::vector({1, 2}));
+         CHECK(to_vector(views::errors(results)) ==
+               std::vector<std::string>({"first", "second"}));
+      }
+      THEN("The adaptors compose with the standard ones")
+      {
+         auto view = results | views::values | std::views::transform([](int i) {
+                        return i * 10;
+                     });
+
+         CHECK(to_vector(view) == std::vector({10, 20}));
+      }
+   }
+   GIVEN("A vector of eithers")
+   {
+      const std::vector<either<int, std::string>> eithers = {left(1), right("a"), right("b"),
+                                                             left(2)};
+
+      THEN("'lefts' & 'rights' yield the matching sides")
+      {
+         CHECK(to_vector(eithers | views::lefts) == std::vector({1, 2}));
+         CHECK(to_vector(eithers | views::rights) == std::vector<std::string>({"a", "b"}));
+      }
+   }
+}
+
+SCENARIO("views - filter_map", "[views]")
+{
+   GIVEN("A range of integers")
+   {
+      const std::vector<int> numbers = {1, 2, 3, 4, 5, 6};
+
+      THEN("Only the values of the monads holding one are kept")
+      {
+         int calls = 0;
+         auto halves = numbers | views::filter_map([&](int i) -> maybe<int> {
+                          ++calls;
+
+                          if (i % 2 == 0)
+                          {
+                             return some(i / 2);
+                          }
+
+                          return none;
+                       });
+
+         STATIC_REQUIRE(std::ranges::input_range<decltype(halves)>);
+         CHECK(to_vector(halves) == std::vector({1, 2, 3}));
+         CHECK(calls == 6);
+      }
+      THEN("The function is called once per element even if values are read twice")
+      {
+         int calls = 0;
+         auto view = views::filter_map(std::views::iota(0, 4), [&](int i) {
+            ++calls;
+            return maybe(some(std::to_string(i)));
+         });
+
+         std::vector<std::string> res;
+         for (auto it = view.begin(); it != view.end(); ++it)
+         {
+            CHECK(!(*it).empty());
+            res.push_back(*it);
+         }
+
+         CHECK(res == std::vector<std::string>({"0", "1", "2", "3"}));
+         CHECK(calls == 4);
+      }
+      THEN("Move-only values may be moved out of the view")
+      {
+         auto view = numbers | views::filter_map([](int i) -> maybe<std::unique_ptr<int>> {
+                        if (i > 4)
+                        {
+                           return some(std::make_unique<int>(i));
+                        }
+
+                        return none;
+                     });
+
+         std::vector<std::unique_ptr<int>> owned;
+         for (auto& ptr : view)
+         {
+            owned.push_back(std::move(ptr));
+         }
+
+         REQUIRE(owned.size() == 2);
+         CHECK(*owned[0] == 5);
+         CHECK(*owned[1] == 6);
+      }
+   }
+}